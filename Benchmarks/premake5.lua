@@ -0,0 +1,76 @@
+project "Benchmarks"
+	kind "ConsoleApp"
+	language "C++"
+	cppdialect "C++20"
+	systemversion "latest"
+	staticruntime "Off"
+
+	targetdir ("%{wks.location}/bin/" .. outputdir .. "/%{prj.name}")
+	objdir ("%{wks.location}/bin-int/" .. outputdir .. "/%{prj.name}")
+
+	files
+	{
+		"src/**.h",
+		"src/**.cpp",
+	}
+
+	includedirs
+	{
+		"%{wks.location}/Indy/src",
+		"%{IncludeDirs.spdlog}",
+	}
+
+	links
+	{
+		"Indy"
+	}
+
+	filter "system:windows"
+
+		defines
+		{
+			"ENGINE_PLATFORM_WINDOWS"
+		}
+
+		includedirs "%{IncludeDirs.GLFW}"
+
+		-- Indy.dll is copied next to Sandbox by Indy's post-build step; the benchmarks need it too.
+		postbuildcommands
+		{
+			("{COPY} %{wks.location}/bin/" .. outputdir .. "/Indy/Indy.dll %{cfg.targetdir}")
+		}
+
+	filter "system:linux"
+
+		defines
+		{
+			"ENGINE_PLATFORM_LINUX"
+		}
+
+		includedirs "%{IncludeDirs.GLFW}"
+
+		-- Finds libIndy.so next to the executable.
+		linkoptions { "-Wl,-rpath,'$$ORIGIN'" }
+
+		links { "pthread" }
+
+		-- libIndy.so is copied next to Sandbox by Indy's post-build step; the benchmarks need it too.
+		postbuildcommands
+		{
+			("{COPY} %{wks.location}/bin/" .. outputdir .. "/Indy/libIndy.so %{cfg.targetdir}")
+		}
+
+	filter "configurations:Debug"
+		defines { "ENGINE_DEBUG" }
+		runtime "Debug"
+		symbols "On"
+
+	filter "configurations:Release"
+		defines { "ENGINE_RELEASE" }
+		runtime "Release"
+		optimize "On"
+
+	filter "configurations:Dist"
+		defines { "ENGINE_DIST" }
+		runtime "Release"
+		optimize "On"
\ No newline at end of file
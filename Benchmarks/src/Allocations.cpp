@@ -0,0 +1,59 @@
+#include "Benchmark.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+/* Counts heap allocations by replacing the global allocation functions.
+*	On Windows the replacement only applies to this executable: allocations made inside Indy.dll
+*	itself are not counted, but template code from the engine headers (event containers, queues,
+*	delegates) is instantiated here and is.
+*/
+
+namespace
+{
+	std::atomic<uint64_t> s_AllocationCount = 0;
+}
+
+namespace Benchmarks
+{
+	uint64_t GetAllocationCount()
+	{
+		return s_AllocationCount.load(std::memory_order_relaxed);
+	}
+}
+
+void* operator new(size_t size)
+{
+	s_AllocationCount.fetch_add(1, std::memory_order_relaxed);
+
+	if (void* memory = std::malloc(size != 0 ? size : 1))
+		return memory;
+
+	throw std::bad_alloc();
+}
+
+void* operator new[](size_t size)
+{
+	return operator new(size);
+}
+
+void operator delete(void* memory) noexcept
+{
+	std::free(memory);
+}
+
+void operator delete[](void* memory) noexcept
+{
+	std::free(memory);
+}
+
+void operator delete(void* memory, size_t) noexcept
+{
+	std::free(memory);
+}
+
+void operator delete[](void* memory, size_t) noexcept
+{
+	std::free(memory);
+}
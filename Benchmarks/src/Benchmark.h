@@ -0,0 +1,90 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+/* Minimal benchmark harness.
+*	A benchmark body receives an iteration count and loops over it itself, so the harness adds no
+*	per-operation overhead. Each body runs once untimed to warm up, then once timed. Results are
+*	reported as wall-clock nanoseconds, process CPU nanoseconds and heap allocations per operation.
+*	CPU time includes every thread, so it shows both parallel work and time spent spinning.
+*/
+
+namespace Benchmarks
+{
+	// Number of global operator new calls made so far by this module. See Allocations.cpp.
+	uint64_t GetAllocationCount();
+
+	// User plus kernel CPU time consumed by the process so far, in nanoseconds. See ProcessTime.cpp.
+	uint64_t GetProcessCpuTime();
+
+	struct BenchmarkResult
+	{
+		std::string_view name;
+		uint64_t iterations;
+		double ns_per_op;
+		double cpu_ns_per_op;
+		double allocations_per_op;
+	};
+
+	// Written by DoNotOptimize. The pointer itself is volatile, so every store to it must happen.
+	inline const void* volatile s_Sink = nullptr;
+
+	// Keeps a value alive so the compiler can't optimize away the work that produced it.
+	template<typename T_Value>
+	inline void DoNotOptimize(const T_Value& value)
+	{
+		s_Sink = &value;
+	}
+
+	class BenchmarkRunner
+	{
+	public:
+		// Only benchmarks whose name contains the filter are run. An empty filter runs everything.
+		BenchmarkRunner(std::string_view filter)
+			: m_Filter(filter) {};
+
+		template<typename T_Body>
+		void run(std::string_view name, uint64_t iterations, T_Body&& body)
+		{
+			if (!m_Filter.empty() && name.find(m_Filter) == std::string_view::npos)
+				return;
+
+			body(iterations / 10 + 1);
+
+			uint64_t allocations = GetAllocationCount();
+			uint64_t cpuTime = GetProcessCpuTime();
+			auto start = std::chrono::steady_clock::now();
+
+			body(iterations);
+
+			auto elapsed = std::chrono::steady_clock::now() - start;
+			cpuTime = GetProcessCpuTime() - cpuTime;
+			allocations = GetAllocationCount() - allocations;
+
+			report({ name, iterations,
+				(double)std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count() / (double)iterations,
+				(double)cpuTime / (double)iterations,
+				(double)allocations / (double)iterations });
+		}
+
+		const std::vector<BenchmarkResult>& getResults() const { return m_Results; };
+
+	private:
+		void report(const BenchmarkResult& result);
+
+	private:
+		std::string_view m_Filter;
+		std::vector<BenchmarkResult> m_Results;
+	};
+
+	// Defined by each benchmark file.
+	void RunEventBenchmarks(BenchmarkRunner& runner);
+	void RunFramePacerBenchmarks(BenchmarkRunner& runner);
+	void RunJobBenchmarks(BenchmarkRunner& runner);
+	void RunMemoryBenchmarks(BenchmarkRunner& runner);
+	void RunPoolBenchmarks(BenchmarkRunner& runner);
+	void RunRenderThreadBenchmarks(BenchmarkRunner& runner);
+}
@@ -0,0 +1,37 @@
+#include "Benchmark.h"
+
+#include "Engine/Core/Log.h"
+
+#include <cstdio>
+
+// Usage: Benchmarks [filter]
+//	Runs every benchmark whose name contains the filter, and prints ns/op, CPU ns/op and allocations/op.
+int main(int argc, char** argv)
+{
+	Engine::Log::Init();
+
+	Benchmarks::BenchmarkRunner runner(argc > 1 ? argv[1] : "");
+
+	std::printf("%-48s %12s %14s %14s %12s\n", "Benchmark", "Iterations", "ns/op", "cpu ns/op", "allocs/op");
+
+	Benchmarks::RunEventBenchmarks(runner);
+	Benchmarks::RunFramePacerBenchmarks(runner);
+	Benchmarks::RunJobBenchmarks(runner);
+	Benchmarks::RunMemoryBenchmarks(runner);
+	Benchmarks::RunPoolBenchmarks(runner);
+	Benchmarks::RunRenderThreadBenchmarks(runner);
+
+	return 0;
+}
+
+namespace Benchmarks
+{
+	void BenchmarkRunner::report(const BenchmarkResult& result)
+	{
+		std::printf("%-48.*s %12llu %14.1f %14.1f %12.3f\n", (int)result.name.size(), result.name.data(),
+			(unsigned long long)result.iterations, result.ns_per_op, result.cpu_ns_per_op, result.allocations_per_op);
+		std::fflush(stdout);
+
+		m_Results.push_back(result);
+	}
+}
@@ -0,0 +1,310 @@
+#include "Benchmark.h"
+
+#include "Engine/EventSystem/Events.h"
+#include "Engine/Jobs/Jobs.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace Benchmarks
+{
+	namespace
+	{
+		// Every scenario uses its own event type, so listeners never leak between benchmarks.
+		template<int T_Id>
+		struct BenchEvent
+		{
+			int value;
+		};
+
+		template<int T_Id>
+		struct ChannelEvent
+		{
+			int value;
+			EventChannel channel;
+
+			EventChannel getChannel() const { return channel; };
+		};
+
+		struct CoalescedEvent
+		{
+			int value;
+
+			static constexpr EventCoalescePolicy CoalescePolicy = EventCoalescePolicy::KeepLast;
+		};
+
+		int s_Counter = 0;
+
+		template<typename T_Event_Type>
+		void FreeListener(const T_Event_Type& event)
+		{
+			s_Counter += event.value;
+		}
+
+		struct MemberListener
+		{
+			int counter = 0;
+
+			void onEvent(const BenchEvent<4>& event) { counter += event.value; };
+		};
+
+		// Busy-waits, standing in for a listener that does real work.
+		void Spin(std::chrono::microseconds duration)
+		{
+			auto end = std::chrono::steady_clock::now() + duration;
+			while (std::chrono::steady_clock::now() < end) {}
+		}
+
+		void UnBindAll(std::vector<EventHandle>& handles)
+		{
+			for (EventHandle& handle : handles)
+				Events::UnBind(handle);
+
+			handles.clear();
+		}
+
+		template<int T_Id>
+		void DispatchWithListeners(BenchmarkRunner& runner, std::string_view name, int listenerCount, uint64_t iterations)
+		{
+			std::vector<EventHandle> handles;
+			for (int i = 0; i < listenerCount; i++)
+				handles.push_back(Events::Bind<BenchEvent<T_Id>>(&FreeListener<BenchEvent<T_Id>>));
+
+			runner.run(name, iterations, [](uint64_t count)
+			{
+				for (uint64_t i = 0; i < count; i++)
+					Events::Dispatch(BenchEvent<T_Id>{ 1 });
+			});
+
+			UnBindAll(handles);
+		}
+
+		// Keeps waiting until the event system shuts down, so it may only refer to static state.
+		EventTask AwaitForever()
+		{
+			for (;;)
+			{
+				BenchEvent<11> event = co_await Events::Next<BenchEvent<11>>();
+				s_Counter += event.value;
+			}
+		}
+	}
+
+	void RunEventBenchmarks(BenchmarkRunner& runner)
+	{
+		// Bind/unbind churn: one bind and one unbind per op, with 100 other listeners bound.
+		{
+			std::vector<EventHandle> handles;
+			for (int i = 0; i < 100; i++)
+				handles.push_back(Events::Bind<BenchEvent<0>>(&FreeListener<BenchEvent<0>>));
+
+			runner.run("bind/unbind churn", 1'000'000, [](uint64_t count)
+			{
+				for (uint64_t i = 0; i < count; i++)
+				{
+					EventHandle handle = Events::Bind<BenchEvent<0>>(&FreeListener<BenchEvent<0>>);
+					Events::UnBind(handle);
+				}
+
+				// Flushes the removed listeners, as the next dispatch would.
+				Events::Dispatch(BenchEvent<0>{ 0 });
+			});
+
+			UnBindAll(handles);
+		}
+
+		// Dispatch cost by listener count. ns/op is per dispatch, not per listener.
+		DispatchWithListeners<1>(runner, "dispatch, 1 listener", 1, 10'000'000);
+		DispatchWithListeners<2>(runner, "dispatch, 10 listeners", 10, 2'000'000);
+		DispatchWithListeners<3>(runner, "dispatch, 1000 listeners", 1000, 20'000);
+
+		// Member function vs free function listeners, 10 of each.
+		{
+			MemberListener listeners[10];
+			std::vector<EventHandle> handles;
+			for (MemberListener& listener : listeners)
+				handles.push_back(Events::Bind<BenchEvent<4>>(&listener, &MemberListener::onEvent));
+
+			runner.run("dispatch, 10 member listeners", 2'000'000, [](uint64_t count)
+			{
+				for (uint64_t i = 0; i < count; i++)
+					Events::Dispatch(BenchEvent<4>{ 1 });
+			});
+
+			UnBindAll(handles);
+			DoNotOptimize(listeners);
+		}
+
+		{
+			std::vector<EventHandle> handles;
+			for (int i = 0; i < 10; i++)
+				handles.push_back(Events::Bind<BenchEvent<5>>([](const BenchEvent<5>& event) { s_Counter += event.value; }));
+
+			runner.run("dispatch, 10 lambda listeners", 2'000'000, [](uint64_t count)
+			{
+				for (uint64_t i = 0; i < count; i++)
+					Events::Dispatch(BenchEvent<5>{ 1 });
+			});
+
+			UnBindAll(handles);
+		}
+
+		// Nested dispatch: each listener of the outer event dispatches an inner event.
+		{
+			std::vector<EventHandle> handles;
+			handles.push_back(Events::Bind<BenchEvent<7>>(&FreeListener<BenchEvent<7>>));
+			for (int i = 0; i < 4; i++)
+				handles.push_back(Events::Bind<BenchEvent<6>>([](const BenchEvent<6>& event) { Events::Dispatch(BenchEvent<7>{ event.value }); }));
+
+			runner.run("nested dispatch, 4 x 1 listeners", 2'000'000, [](uint64_t count)
+			{
+				for (uint64_t i = 0; i < count; i++)
+					Events::Dispatch(BenchEvent<6>{ 1 });
+			});
+
+			UnBindAll(handles);
+		}
+
+		// Dispatch after 90% of 1000 listeners were removed. The first dispatch compacts the container.
+		{
+			std::vector<EventHandle> handles;
+			for (int i = 0; i < 1000; i++)
+				handles.push_back(Events::Bind<BenchEvent<8>>(&FreeListener<BenchEvent<8>>));
+
+			for (size_t i = 0; i < handles.size(); i++)
+			{
+				if (i % 10 != 0)
+					Events::UnBind(handles[i]);
+			}
+
+			runner.run("dispatch, 1000 listeners with 90% removed", 200'000, [](uint64_t count)
+			{
+				for (uint64_t i = 0; i < count; i++)
+					Events::Dispatch(BenchEvent<8>{ 1 });
+			});
+
+			UnBindAll(handles);
+		}
+
+		// Channel fan-out: 100 channels with 10 listeners each. Only one channel's listeners run.
+		{
+			std::vector<EventHandle> handles;
+			for (EventChannel channel = 0; channel < 100; channel++)
+			{
+				for (int i = 0; i < 10; i++)
+					handles.push_back(Events::BindChannel<ChannelEvent<0>>(channel, [](const ChannelEvent<0>& event) { s_Counter += event.value; }));
+			}
+
+			runner.run("channel dispatch, 100 channels x 10 listeners", 2'000'000, [](uint64_t count)
+			{
+				for (uint64_t i = 0; i < count; i++)
+					Events::Dispatch(ChannelEvent<0>{ 1, i % 100 });
+			});
+
+			UnBindAll(handles);
+		}
+
+		// Cross-thread enqueue: producers push while the main thread drains. ns/op is per event.
+		{
+			EventHandle handle = Events::Bind<BenchEvent<9>>(&FreeListener<BenchEvent<9>>);
+
+			runner.run("cross-thread enqueue, 3 producers", 3'000'000, [](uint64_t count)
+			{
+				constexpr uint64_t Producers = 3;
+				std::atomic<uint64_t> dispatched = 0;
+
+				EventHandle counter = Events::Bind<BenchEvent<9>>([&dispatched](const BenchEvent<9>&) { dispatched.fetch_add(1, std::memory_order_relaxed); });
+
+				std::vector<std::thread> producers;
+				for (uint64_t p = 0; p < Producers; p++)
+				{
+					producers.emplace_back([count, p]()
+					{
+						for (uint64_t i = p; i < count; i += Producers)
+						{
+							while (!Events::Enqueue(BenchEvent<9>{ 1 }))
+								std::this_thread::yield();
+						}
+					});
+				}
+
+				while (dispatched.load(std::memory_order_relaxed) < count)
+					Events::DispatchQueued();
+
+				for (std::thread& producer : producers)
+					producer.join();
+
+				Events::UnBind(counter);
+			});
+
+			Events::UnBind(handle);
+		}
+
+		// Queue coalescing: KeepLast events are folded into one dispatch per drain.
+		{
+			EventHandle handle = Events::Bind<CoalescedEvent>([](const CoalescedEvent& event) { s_Counter += event.value; });
+
+			runner.run("enqueue + drain, KeepLast coalescing", 5'000'000, [](uint64_t count)
+			{
+				for (uint64_t i = 0; i < count; i++)
+				{
+					Events::Enqueue(CoalescedEvent{ 1 });
+
+					if (i % 64 == 63)
+						Events::DispatchQueued();
+				}
+
+				Events::DispatchQueued();
+			});
+
+			Events::UnBind(handle);
+		}
+
+		// Coroutines resumed by dispatch, 10 waiting at all times.
+		{
+			for (int i = 0; i < 10; i++)
+				AwaitForever();
+
+			runner.run("dispatch, 10 awaiting coroutines", 2'000'000, [](uint64_t count)
+			{
+				for (uint64_t i = 0; i < count; i++)
+					Events::Dispatch(BenchEvent<11>{ 1 });
+			});
+		}
+
+		// 64 independent listeners doing ~50us of work each, run serially and on the job system.
+		{
+			std::vector<EventHandle> handles;
+			for (int i = 0; i < 64; i++)
+			{
+				handles.push_back(Events::Bind<BenchEvent<10>>([](const BenchEvent<10>&) { Spin(std::chrono::microseconds(50)); },
+					EventPriority{ EventPhase::Gameplay, 0, true }));
+			}
+
+			bool b_WasRunning = Engine::Jobs::IsRunning();
+
+			Engine::Jobs::Stop();
+			runner.run("64 x 50us independent listeners, serial", 50, [](uint64_t count)
+			{
+				for (uint64_t i = 0; i < count; i++)
+					Events::Dispatch(BenchEvent<10>{ 1 });
+			});
+
+			Engine::Jobs::Start();
+			runner.run("64 x 50us independent listeners, parallel", 50, [](uint64_t count)
+			{
+				for (uint64_t i = 0; i < count; i++)
+					Events::Dispatch(BenchEvent<10>{ 1 });
+			});
+
+			if (!b_WasRunning)
+				Engine::Jobs::Stop();
+
+			UnBindAll(handles);
+		}
+
+		DoNotOptimize(s_Counter);
+	}
+}
@@ -0,0 +1,46 @@
+#include "Benchmark.h"
+
+#include "Engine/Core/FramePacer.h"
+
+#include <chrono>
+
+namespace Benchmarks
+{
+	namespace
+	{
+		constexpr double TargetFPS = 120.0;
+
+		// What a naive frame limiter does: spin on the clock until the next frame is due.
+		void SpinUntil(std::chrono::steady_clock::time_point deadline)
+		{
+			while (std::chrono::steady_clock::now() < deadline) {}
+		}
+	}
+
+	// Empty frames paced to 120 FPS. ns/op is the frame time, cpu ns/op the CPU time it cost;
+	//	no window is involved, so this runs headless.
+	void RunFramePacerBenchmarks(BenchmarkRunner& runner)
+	{
+		runner.run("120 fps frames, busy-wait limiter", 240, [](uint64_t count)
+		{
+			auto period = std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(1.0 / TargetFPS));
+			auto next = std::chrono::steady_clock::now() + period;
+
+			for (uint64_t i = 0; i < count; i++, next += period)
+				SpinUntil(next);
+		});
+
+		double previousFPS = Engine::FramePacer::GetTargetFPS();
+		Engine::FramePacer::Init();
+		Engine::FramePacer::SetTargetFPS(TargetFPS);
+
+		runner.run("120 fps frames, FramePacer", 240, [](uint64_t count)
+		{
+			for (uint64_t i = 0; i < count; i++)
+				Engine::FramePacer::Wait();
+		});
+
+		Engine::FramePacer::SetTargetFPS(previousFPS);
+		Engine::FramePacer::Shutdown();
+	}
+}
@@ -0,0 +1,145 @@
+#include "Benchmark.h"
+
+#include "Engine/Jobs/Jobs.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+
+namespace Benchmarks
+{
+	namespace
+	{
+		std::atomic<uint64_t> s_Work = 0;
+
+		// Busy-waits, standing in for a job that does real work.
+		void Spin(std::chrono::microseconds duration)
+		{
+			auto end = std::chrono::steady_clock::now() + duration;
+			while (std::chrono::steady_clock::now() < end) {}
+		}
+
+		// Spawns three children and waits for them, down to leaves that do ~5us of work each.
+		void TreeJob(void* context)
+		{
+			uintptr_t depth = reinterpret_cast<uintptr_t>(context);
+
+			if (depth == 0)
+			{
+				Spin(std::chrono::microseconds(5));
+				s_Work.fetch_add(1, std::memory_order_relaxed);
+				return;
+			}
+
+			Engine::JobCounter counter;
+			for (int i = 0; i < 3; i++)
+				Engine::Jobs::Run(&TreeJob, reinterpret_cast<void*>(depth - 1), &counter);
+
+			Engine::Jobs::Wait(counter);
+		}
+
+		void EmptyJob(void*) {}
+
+		std::atomic<uint64_t> s_Waited = 0;
+
+		void WaitingChildJob(void*)
+		{
+			Engine::JobCounter counter;
+			Engine::Jobs::Run(&EmptyJob, nullptr, &counter);
+			Engine::Jobs::Wait(counter);
+
+			s_Waited.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		// Spawns more children than a thread's job ring holds, so scheduling them wraps the ring onto
+		//	children that haven't started yet. Each child waits on a job of its own.
+		void WrappingParentJob(void*)
+		{
+			Engine::JobCounter counter;
+			for (int i = 0; i < 10000; i++)
+				Engine::Jobs::Run(&WaitingChildJob, nullptr, &counter);
+
+			Engine::Jobs::Wait(counter);
+		}
+
+		void RunModeBenchmarks(BenchmarkRunner& runner, Engine::Jobs::Mode mode)
+		{
+			Engine::Jobs::Start(0, mode);
+
+			bool b_Fibers = mode == Engine::Jobs::Mode::Fibers;
+
+			// Scheduling overhead: 1000 empty jobs on one counter. ns/op is per job.
+			runner.run(b_Fibers ? "jobs, 1000 empty jobs, fibers" : "jobs, 1000 empty jobs, threads", 1'000'000, [](uint64_t count)
+			{
+				for (uint64_t i = 0; i < count; i += 1000)
+				{
+					Engine::JobCounter counter;
+					for (int j = 0; j < 1000; j++)
+						Engine::Jobs::Run(&EmptyJob, nullptr, &counter);
+
+					Engine::Jobs::Wait(counter);
+				}
+			});
+
+			// Deeply nested dependent jobs: a 3-ary tree of depth 6 (1093 jobs, 729 leaves). ns/op is per tree.
+			runner.run(b_Fibers ? "jobs, nested tree 3^6, fibers" : "jobs, nested tree 3^6, threads", 20, [](uint64_t count)
+			{
+				for (uint64_t i = 0; i < count; i++)
+				{
+					Engine::JobCounter counter;
+					Engine::Jobs::Run(&TreeJob, reinterpret_cast<void*>(uintptr_t(6)), &counter);
+					Engine::Jobs::Wait(counter);
+				}
+			});
+
+			// Nested ParallelFor: 64 outer iterations, each a 1000 index ParallelFor. ns/op is per outer loop.
+			runner.run(b_Fibers ? "jobs, nested ParallelFor 64 x 1000, fibers" : "jobs, nested ParallelFor 64 x 1000, threads", 200, [](uint64_t count)
+			{
+				for (uint64_t i = 0; i < count; i++)
+				{
+					Engine::Jobs::ParallelFor(64, 1, [](size_t)
+					{
+						Engine::Jobs::ParallelFor(1000, 50, [](size_t index) { s_Work.fetch_add(index, std::memory_order_relaxed); });
+					});
+				}
+			});
+
+			// A saturated job ring under waiting jobs. ns/op is per parent; every child must have finished.
+			runner.run(b_Fibers ? "jobs, 10000 waiting children, fibers" : "jobs, 10000 waiting children, threads", 20, [](uint64_t count)
+			{
+				for (uint64_t i = 0; i < count; i++)
+				{
+					s_Waited.store(0, std::memory_order_relaxed);
+
+					Engine::JobCounter counter;
+					Engine::Jobs::Run(&WrappingParentJob, nullptr, &counter);
+					Engine::Jobs::Wait(counter);
+
+					if (s_Waited.load(std::memory_order_relaxed) != 10000)
+						std::printf("jobs, 10000 waiting children: only %llu children finished!\n", (unsigned long long)s_Waited.load());
+				}
+			});
+
+			Engine::Jobs::Stop();
+		}
+	}
+
+	// Thread mode waits by running other jobs on the waiting job's stack; fiber mode parks the
+	//	waiting job instead. Both use every hardware thread.
+	void RunJobBenchmarks(BenchmarkRunner& runner)
+	{
+		bool b_WasRunning = Engine::Jobs::IsRunning();
+		Engine::Jobs::Mode previousMode = Engine::Jobs::GetMode();
+
+		Engine::Jobs::Stop();
+
+		RunModeBenchmarks(runner, Engine::Jobs::Mode::Threads);
+		RunModeBenchmarks(runner, Engine::Jobs::Mode::Fibers);
+
+		if (b_WasRunning)
+			Engine::Jobs::Start(0, previousMode);
+
+		DoNotOptimize(s_Work);
+	}
+}
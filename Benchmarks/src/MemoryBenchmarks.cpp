@@ -0,0 +1,101 @@
+#include "Benchmark.h"
+
+#include "Engine/Core/Log.h"
+#include "Engine/Memory/FrameAllocator.h"
+
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+namespace Benchmarks
+{
+	namespace
+	{
+		// A frame's worth of operations between resets.
+		constexpr uint64_t OpsPerFrame = 256;
+
+		struct Transient
+		{
+			float values[16];
+		};
+	}
+
+	// Temporary allocations as a frame would make them. ns/op covers 16 allocations, or one reserved
+	//	vector filled with 256 elements, and includes the frame resets. Vectors that grow leave their old
+	//	storage behind in the arena, so frame memory suits arrays whose size is known up front.
+	void RunMemoryBenchmarks(BenchmarkRunner& runner)
+	{
+		// The allocator logs its statistics when shut down, which would split the report.
+		auto level = Engine::Log::GetCoreLogger()->level();
+		Engine::Log::GetCoreLogger()->set_level(spdlog::level::warn);
+
+		Engine::FrameAllocator::Init();
+
+		runner.run("16 x 64 byte allocations, new/delete", 1'000'000, [](uint64_t count)
+		{
+			Transient* objects[16];
+
+			for (uint64_t i = 0; i < count; i++)
+			{
+				for (Transient*& object : objects)
+					object = new Transient();
+
+				DoNotOptimize(objects);
+
+				for (Transient* object : objects)
+					delete object;
+			}
+		});
+
+		runner.run("16 x 64 byte allocations, FrameAllocator", 1'000'000, [](uint64_t count)
+		{
+			Transient* objects[16];
+
+			for (uint64_t i = 0; i < count; i++)
+			{
+				if (i % OpsPerFrame == 0)
+					Engine::FrameAllocator::BeginFrame();
+
+				for (Transient*& object : objects)
+					object = Engine::FrameAllocator::New<Transient>();
+
+				DoNotOptimize(objects);
+			}
+		});
+
+		runner.run("256 element vector, std::vector", 500'000, [](uint64_t count)
+		{
+			for (uint64_t i = 0; i < count; i++)
+			{
+				std::vector<int> values;
+				values.reserve(256);
+
+				for (int j = 0; j < 256; j++)
+					values.push_back(j);
+
+				DoNotOptimize(values.data());
+			}
+		});
+
+		runner.run("256 element vector, std::pmr on FrameAllocator", 500'000, [](uint64_t count)
+		{
+			for (uint64_t i = 0; i < count; i++)
+			{
+				if (i % OpsPerFrame == 0)
+					Engine::FrameAllocator::BeginFrame();
+
+				std::pmr::vector<int> values(Engine::FrameAllocator::GetResource());
+				values.reserve(256);
+
+				for (int j = 0; j < 256; j++)
+					values.push_back(j);
+
+				DoNotOptimize(values.data());
+			}
+		});
+
+		Engine::FrameAllocator::Shutdown();
+
+		Engine::Log::GetCoreLogger()->set_level(level);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,145 @@
+#include "Benchmark.h"
+
+#include "Engine/EventSystem/Events.h"
+#include "Engine/Jobs/Jobs.h"
+#include "Engine/Memory/Pool.h"
+
+#include <memory>
+#include <vector>
+
+namespace Benchmarks
+{
+	namespace
+	{
+		constexpr uint32_t LiveObjects = 64;
+		constexpr int ListenersPerWindow = 24;
+
+		struct Object
+		{
+			uint64_t values[8];
+		};
+
+		template<int T_Id>
+		struct WindowEvent
+		{
+			int value;
+		};
+
+		// Shaped like a platform window: binds its listeners when created and unbinds them when destroyed.
+		class WindowLike
+		{
+		public:
+			WindowLike()
+			{
+				m_EventHandles.reserve(ListenersPerWindow);
+
+				for (int i = 0; i < ListenersPerWindow / 3; i++)
+				{
+					m_EventHandles.push_back(Events::Bind<WindowEvent<0>>(this, &WindowLike::onEvent<0>));
+					m_EventHandles.push_back(Events::Bind<WindowEvent<1>>(this, &WindowLike::onEvent<1>));
+					m_EventHandles.push_back(Events::Bind<WindowEvent<2>>(this, &WindowLike::onEvent<2>));
+				}
+			}
+
+			~WindowLike()
+			{
+				for (EventHandle& handle : m_EventHandles)
+					Events::UnBind(handle);
+			}
+
+		private:
+			template<int T_Id>
+			void onEvent(const WindowEvent<T_Id>& event) { m_Counter += event.value; };
+
+		private:
+			std::vector<EventHandle> m_EventHandles;
+			int m_Counter = 0;
+		};
+
+		// Replaces the oldest of LiveObjects objects with a new one, once per op.
+		template<typename T_Create, typename T_Destroy>
+		void Churn(uint64_t count, T_Create&& create, T_Destroy&& destroy)
+		{
+			Object* objects[LiveObjects];
+			for (Object*& object : objects)
+				object = create();
+
+			for (uint64_t i = 0; i < count; i++)
+			{
+				Object*& object = objects[i % LiveObjects];
+				destroy(object);
+				object = create();
+			}
+
+			for (Object* object : objects)
+				destroy(object);
+		}
+	}
+
+	// Object churn against std::make_unique. ns/op is one destruction plus one creation; for the
+	//	window-style objects, that includes binding and unbinding their 24 listeners.
+	void RunPoolBenchmarks(BenchmarkRunner& runner)
+	{
+		runner.run("object churn, std::make_unique", 5'000'000, [](uint64_t count)
+		{
+			Churn(count, []() { return std::make_unique<Object>().release(); }, [](Object* object) { delete object; });
+		});
+
+		runner.run("object churn, Pool", 5'000'000, [](uint64_t count)
+		{
+			Engine::Pool<Object> pool;
+			Churn(count, [&pool]() { return pool.New(); }, [&pool](Object* object) { pool.Delete(object); });
+		});
+
+		{
+			bool b_WasRunning = Engine::Jobs::IsRunning();
+			Engine::Jobs::Start();
+
+			runner.run("object churn, Pool with thread caches", 5'000'000, [](uint64_t count)
+			{
+				Engine::Pool<Object, true> pool;
+				Churn(count, [&pool]() { return pool.New(); }, [&pool](Object* object) { pool.Delete(object); });
+			});
+
+			if (!b_WasRunning)
+				Engine::Jobs::Stop();
+		}
+
+		{
+			Engine::Pool<Object> pool;
+			std::vector<Engine::PoolHandle<Object>> handles;
+			for (uint32_t i = 0; i < 1024; i++)
+				handles.push_back(pool.Create());
+
+			runner.run("handle lookup, Pool", 20'000'000, [&pool, &handles](uint64_t count)
+			{
+				uint64_t sum = 0;
+				for (uint64_t i = 0; i < count; i++)
+					sum += pool.Get(handles[i % handles.size()])->values[0];
+
+				DoNotOptimize(sum);
+			});
+		}
+
+		runner.run("window with 24 listeners, std::make_unique", 200'000, [](uint64_t count)
+		{
+			for (uint64_t i = 0; i < count; i++)
+			{
+				std::unique_ptr<WindowLike> window = std::make_unique<WindowLike>();
+				DoNotOptimize(window);
+			}
+		});
+
+		runner.run("window with 24 listeners, Pool", 200'000, [](uint64_t count)
+		{
+			Engine::Pool<WindowLike> pool;
+
+			for (uint64_t i = 0; i < count; i++)
+			{
+				WindowLike* window = pool.New();
+				DoNotOptimize(window);
+				pool.Delete(window);
+			}
+		});
+	}
+}
\ No newline at end of file
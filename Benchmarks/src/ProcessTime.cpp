@@ -0,0 +1,30 @@
+#include "Benchmark.h"
+
+#ifdef ENGINE_PLATFORM_WINDOWS
+	#ifndef WIN32_LEAN_AND_MEAN
+		#define WIN32_LEAN_AND_MEAN
+	#endif
+	#include <Windows.h>
+#else
+	#include <sys/resource.h>
+#endif
+
+namespace Benchmarks
+{
+	uint64_t GetProcessCpuTime()
+	{
+		#ifdef ENGINE_PLATFORM_WINDOWS
+			FILETIME creation, exit, kernel, user;
+			GetProcessTimes(GetCurrentProcess(), &creation, &exit, &kernel, &user);
+
+			auto toNanoseconds = [](const FILETIME& time) { return ((uint64_t)time.dwHighDateTime << 32 | time.dwLowDateTime) * 100; };
+			return toNanoseconds(kernel) + toNanoseconds(user);
+		#else
+			rusage usage;
+			getrusage(RUSAGE_SELF, &usage);
+
+			auto toNanoseconds = [](const timeval& time) { return (uint64_t)time.tv_sec * 1'000'000'000 + (uint64_t)time.tv_usec * 1'000; };
+			return toNanoseconds(usage.ru_utime) + toNanoseconds(usage.ru_stime);
+		#endif
+	}
+}
@@ -0,0 +1,63 @@
+#include "Benchmark.h"
+
+#include "Engine/Core/Log.h"
+#include "Engine/Renderer/RenderThread.h"
+
+#include <chrono>
+#include <thread>
+
+namespace Benchmarks
+{
+	namespace
+	{
+		constexpr std::chrono::microseconds SimulationTime{ 2000 };
+		constexpr std::chrono::microseconds PresentTime{ 16667 };
+
+		// Stands in for a swap that blocks on a 60 Hz vsync. It sleeps, so it costs no CPU.
+		class VSyncRenderThread : public Engine::RenderThread
+		{
+		public:
+			~VSyncRenderThread() { Stop(); };
+
+		protected:
+			void onRender(const Engine::FramePacket& packet) override { std::this_thread::sleep_for(PresentTime); };
+		};
+
+		void Spin(std::chrono::microseconds duration)
+		{
+			auto end = std::chrono::steady_clock::now() + duration;
+			while (std::chrono::steady_clock::now() < end) {}
+		}
+
+		void RunFrames(bool b_Threaded, uint64_t count)
+		{
+			VSyncRenderThread renderThread;
+			renderThread.Start(b_Threaded);
+
+			for (uint64_t i = 0; i < count; i++)
+			{
+				Engine::FramePacket& packet = renderThread.BeginPacket();
+				packet.frame = i;
+
+				Spin(SimulationTime);
+
+				renderThread.SubmitPacket();
+			}
+		}
+	}
+
+	// Frames with 2ms of simulation, presented with a 60 Hz vsync. ns/op is the main thread's frame
+	//	time, which bounds how long polled input waits to be simulated. With a render thread it's the
+	//	simulation time alone; inline, every frame also waits for the present.
+	void RunRenderThreadBenchmarks(BenchmarkRunner& runner)
+	{
+		// The render thread logs its statistics when stopped, which would split the report.
+		auto level = Engine::Log::GetCoreLogger()->level();
+		Engine::Log::GetCoreLogger()->set_level(spdlog::level::warn);
+
+		runner.run("2ms frames, 60 Hz vsync, inline present", 60, [](uint64_t count) { RunFrames(false, count); });
+		runner.run("2ms frames, 60 Hz vsync, render thread", 60, [](uint64_t count) { RunFrames(true, count); });
+
+		Engine::Log::GetCoreLogger()->set_level(level);
+	}
+}
\ No newline at end of file
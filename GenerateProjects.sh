@@ -0,0 +1,3 @@
+#!/bin/sh
+# Generates makefiles with premake5 from your PATH. Pass --cc=clang to build with clang.
+premake5 gmake2 "$@"
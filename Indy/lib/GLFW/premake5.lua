@@ -44,6 +44,8 @@ filter "system:linux"
         "src/xkb_unicode.c",
         "src/posix_time.c",
         "src/posix_thread.c",
+        "src/posix_module.c",
+        "src/posix_poll.c",
         "src/glx_context.c",
         "src/egl_context.c",
         "src/osmesa_context.c",
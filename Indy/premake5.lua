@@ -22,8 +22,7 @@ project "Indy"
 
 	links
 	{
-		"GLFW",
-		"opengl32.lib"
+		"GLFW"
 	}
 
 	filter "system:windows"
@@ -35,6 +34,12 @@ project "Indy"
 			"ENGINE_BUILD_DLL"
 		}
 
+		links
+		{
+			"opengl32.lib",
+			"winmm.lib"
+		}
+
 		-- It should be noted that if Sandbox has not been built and/or the Sandbox folder
 		--	has not been created, this command will fail
 		postbuildcommands
@@ -42,6 +47,30 @@ project "Indy"
 			("{COPY} %{cfg.buildtarget.relpath} ../bin/" .. outputdir .. "/Sandbox")
 		}
 
+	-- gcc by default; generate with --cc=clang for clang
+	filter "system:linux"
+		pic "On"
+		visibility "Hidden"
+
+		defines
+		{
+			"ENGINE_PLATFORM_LINUX",
+			"ENGINE_BUILD_DLL"
+		}
+
+		links
+		{
+			"GL",
+			"X11",
+			"dl",
+			"pthread"
+		}
+
+		postbuildcommands
+		{
+			("{COPY} %{cfg.buildtarget.relpath} ../bin/" .. outputdir .. "/Sandbox")
+		}
+
 	filter "configurations:Debug"
 		defines { "ENGINE_DEBUG" }
 		runtime "Debug"
@@ -8,12 +8,25 @@
 // Logging
 #include "Engine/Core/Log.h"
 
+// Time
+#include "Engine/Core/Time.h"
+#include "Engine/Core/FramePacer.h"
+
+// Rendering
+#include "Engine/Renderer/RenderThread.h"
+
+// Jobs
+#include "Engine/Jobs/Jobs.h"
+
+// Memory
+#include "Engine/Memory/FrameAllocator.h"
+#include "Engine/Memory/Pool.h"
+
 // Event System
 #include "Engine/EventSystem/Events.h" 
 
-#ifdef ENGINE_PLATFORM_WINDOWS
-	#include "Engine/Platform/Windows/WindowsEvents.h"
-#endif
+// Window and input events
+#include "Engine/Platform/GLFW/GLFWEvents.h"
 
 // ----- Entry Point -----
 #include "Engine/Core/EntryPoint.h"
\ No newline at end of file
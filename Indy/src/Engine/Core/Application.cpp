@@ -1,36 +1,142 @@
 #include "Application.h"
 
+#include "FramePacer.h"
 #include "Log.h"
+#include "Time.h"
 
-#include "Engine/EventSystem/Events.h";
+#include "Engine/EventSystem/Events.h"
+#include "Engine/EventSystem/EventRecorder.h"
+#include "Engine/EventSystem/EventReplayer.h"
+#include "Engine/Jobs/Jobs.h"
+#include "Engine/Memory/FrameAllocator.h"
+#include "Engine/Platform/GLFW/GLFWEvents.h"
 
-#ifdef ENGINE_PLATFORM_WINDOWS
-	#include "Engine/Platform/Windows/WindowsEvents.h"
-#endif
+#include <cstdlib>
+#include <vector>
 
 namespace Engine
 {
+	namespace
+	{
+		std::vector<std::string_view> s_CommandLine;
+
+		// True if the environment variable is set to a non-zero number.
+		bool GetEnvironmentFlag(const char* name)
+		{
+			const char* value = std::getenv(name);
+			return value != nullptr && std::atoi(value) != 0;
+		}
+	}
+
 	Application::Application()
 	{
 		Log::Init();
 
-		m_Window = std::unique_ptr<Window>(Window::Create());
+		// INDY_JOB_FIBERS=1 runs jobs on fibers, so waiting jobs park instead of nesting (see Jobs.h).
+		Jobs::Start(0, GetEnvironmentFlag("INDY_JOB_FIBERS") ? Jobs::Mode::Fibers : Jobs::Mode::Threads);
+
+		// Started after the job system, so every worker gets its own arena.
+		FrameAllocator::Init();
+
+		// --headless or INDY_HEADLESS=1 runs without a display or GPU (see HeadlessWindow).
+		m_Headless = HasCommandLineFlag("--headless") || GetEnvironmentFlag("INDY_HEADLESS");
+
+		WindowSpec spec;
+		spec.b_Headless = m_Headless;
+
+		// --inline-render or INDY_INLINE_RENDER=1 draws on the main thread instead of a render thread.
+		spec.b_RenderThread = !HasCommandLineFlag("--inline-render") && !GetEnvironmentFlag("INDY_INLINE_RENDER");
+
+		m_Window = std::unique_ptr<Window>(Window::Create(spec));
+
+		// Only closing the window ends the application, so it doesn't start without one.
+		if (!m_Window->IsOpen())
+		{
+			INDY_CORE_CRITICAL("The application's window could not be opened.");
+			TerminateApp();
+		}
+
+		// The frame clock uses GLFW's timer, which is available once the window has initialized GLFW.
+		Time::Init();
+		FramePacer::Init();
+
+		// A swap blocking on vsync used to throttle the main loop. On a render thread it no longer does,
+		//	so the main loop is paced to the display instead of simulating frames that are never drawn.
+		if (spec.b_RenderThread && m_Window->IsOpen())
+			FramePacer::SetTargetFPS(m_Window->GetRefreshRate());
 		
 		// Terminate our application if the window closes
 		Events::Bind<WindowCloseEvent>([this](const WindowCloseEvent& event) 
 			{ if (event.b_AppShouldTerminate) TerminateApp(); });
+
+		// Input can be recorded to, or replayed from, an event log (see EventRecorder).
+		//	INDY_REPLAY_SPEED sets the replay speed; 0 replays one recorded frame per frame.
+		EventRecorder::Record<KeyboardEvent>();
+		EventRecorder::Record<MouseButtonEvent>();
+		EventRecorder::Record<MouseMoveEvent>();
+		EventRecorder::Record<WindowResizeEvent>();
+
+		if (const char* path = std::getenv("INDY_RECORD_EVENTS"))
+			EventRecorder::Start(path);
+
+		if (const char* path = std::getenv("INDY_REPLAY_EVENTS"))
+		{
+			const char* speed = std::getenv("INDY_REPLAY_SPEED");
+			EventReplayer::Start(path, speed != nullptr ? std::atof(speed) : 1.0);
+		}
 	}
 
 	Application::~Application()
 	{
+		EventReplayer::Stop();
+		EventRecorder::Stop();
+
+		Events::LogDispatchStats();
 
+		// Stops the render thread, which may still be drawing from frame memory.
+		m_Window.reset();
+
+		FramePacer::Shutdown();
+
+		Jobs::Stop();
+
+		FrameAllocator::Shutdown();
 	}
 
 	void Application::Run()
 	{
 		while (m_IsRunning)
 		{
+			Time::BeginFrame();
+			FrameAllocator::BeginFrame();
+
+			// OS events are polled first, so input is simulated in the frame it arrives in.
 			m_Window->onUpdate();
+
+			// Replayed events follow, as if they had been queued during the last frame.
+			EventReplayer::Update();
+
+			// Events queued from other threads since the last frame are handled before the simulation.
+			Events::DispatchQueued();
+
+			while (Time::StepFixed())
+				onFixedUpdate(Time::GetFixedTimestep());
+
+			onUpdate(Time::GetDelta());
+
+			// The render thread draws this frame while the next one is simulated.
+			FramePacket& packet = m_Window->BeginFramePacket();
+			packet.frame = Time::GetFrameIndex();
+			packet.time = Time::GetTime();
+			packet.alpha = Time::GetAlpha();
+
+			onRender(packet);
+
+			m_Window->SubmitFramePacket();
+
+			EventRecorder::NextFrame();
+
+			FramePacer::Wait();
 		}
 	}
 
@@ -38,5 +144,21 @@ namespace Engine
 	{
 		m_IsRunning = false;
 	}
+
+	void Application::SetCommandLine(int argc, char** argv)
+	{
+		s_CommandLine.assign(argv, argv + argc);
+	}
+
+	bool Application::HasCommandLineFlag(std::string_view flag)
+	{
+		for (std::string_view argument : s_CommandLine)
+		{
+			if (argument == flag)
+				return true;
+		}
+
+		return false;
+	}
 }
 
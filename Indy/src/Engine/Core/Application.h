@@ -3,6 +3,8 @@
 #include "Core.h"
 #include "Window.h"
 
+#include <string_view>
+
 namespace Engine
 {
 	class ENGINE_API Application
@@ -14,10 +16,28 @@ namespace Engine
 		virtual void Run();
 		virtual void TerminateApp();
 
+		bool IsHeadless() const { return m_Headless; };
+
+		// Set by the entry point before the application is created.
+		static void SetCommandLine(int argc, char** argv);
+		static bool HasCommandLineFlag(std::string_view flag);
+
+		// Called zero or more times per frame, once per fixed timestep (see Time).
+		virtual void onFixedUpdate(double fixedDeltaTime) {};
+
+		// Called once per frame, after the fixed updates. Time::GetAlpha() gives the interpolation
+		//	factor between the last two fixed updates.
+		virtual void onUpdate(double deltaTime) {};
+
+		// Called once per frame, after onUpdate, to fill the frame's packet. The packet is drawn later
+		//	on the render thread, so its commands must not refer to state the next frame changes.
+		virtual void onRender(FramePacket& packet) {};
+
 	protected:
 		std::unique_ptr<Window> m_Window;
 
 		bool m_IsRunning = true;
+		bool m_Headless = false;
 	};
 
 	// Defined in client.
@@ -6,6 +6,9 @@
 	#else
 		#define ENGINE_API __declspec(dllimport)
 	#endif	
+#elif defined(ENGINE_PLATFORM_LINUX)
+	// The engine is built with hidden symbol visibility, so only ENGINE_API symbols are exported.
+	#define ENGINE_API __attribute__((visibility("default")))
 #else
-	#error Indy currently only supports Windows!
+	#error Indy currently only supports Windows and Linux!
 #endif
\ No newline at end of file
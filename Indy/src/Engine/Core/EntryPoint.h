@@ -1,11 +1,13 @@
 #pragma once
 
-#ifdef ENGINE_PLATFORM_WINDOWS
+#if defined(ENGINE_PLATFORM_WINDOWS) || defined(ENGINE_PLATFORM_LINUX)
 
 	extern Engine::Application* Engine::CreateApplication();
 
 	int main(int argc, char** argv)
 	{
+		Engine::Application::SetCommandLine(argc, argv);
+
 		auto app = Engine::CreateApplication();
 		app->Run();
 		delete app;
@@ -0,0 +1,157 @@
+#include "FramePacer.h"
+#include "Log.h"
+
+#include <chrono>
+#include <cmath>
+#include <thread>
+
+#ifdef ENGINE_PLATFORM_WINDOWS
+	#ifndef WIN32_LEAN_AND_MEAN
+		#define WIN32_LEAN_AND_MEAN
+	#endif
+	#ifndef NOMINMAX
+		#define NOMINMAX
+	#endif
+	#include <Windows.h>
+	#include <timeapi.h>
+#endif
+
+namespace Engine
+{
+	namespace
+	{
+		using Clock = std::chrono::steady_clock;
+
+		constexpr std::chrono::milliseconds SleepSlice{ 1 };
+
+		// Sleep statistics are restarted periodically, so the estimate follows changes in scheduler behavior.
+		constexpr uint32_t MaxSleepSamples = 1000;
+
+		struct PacerState
+		{
+			double target_fps = 0.0;
+			double unfocused_timeout = 0.1;
+
+			Clock::time_point next_frame;
+			bool b_Started = false;
+
+			// Running mean and variance (Welford) of observed sleep durations, in seconds.
+			double sleep_estimate = 5e-3;
+			double sleep_mean = 5e-3;
+			double sleep_m2 = 0.0;
+			uint32_t sleep_samples = 1;
+		};
+
+		PacerState s_Pacer;
+
+		double ToSeconds(Clock::duration duration)
+		{
+			return std::chrono::duration<double>(duration).count();
+		}
+
+		void RecordSleep(double observed)
+		{
+			if (s_Pacer.sleep_samples == MaxSleepSamples)
+			{
+				s_Pacer.sleep_mean = s_Pacer.sleep_estimate;
+				s_Pacer.sleep_m2 = 0.0;
+				s_Pacer.sleep_samples = 1;
+			}
+
+			s_Pacer.sleep_samples++;
+
+			double delta = observed - s_Pacer.sleep_mean;
+			s_Pacer.sleep_mean += delta / s_Pacer.sleep_samples;
+			s_Pacer.sleep_m2 += delta * (observed - s_Pacer.sleep_mean);
+
+			double deviation = std::sqrt(s_Pacer.sleep_m2 / (s_Pacer.sleep_samples - 1));
+			s_Pacer.sleep_estimate = s_Pacer.sleep_mean + deviation;
+		}
+
+		void WaitUntil(Clock::time_point deadline)
+		{
+			// Sleep while the remaining time is safely longer than a sleep is expected to take.
+			for (;;)
+			{
+				Clock::time_point start = Clock::now();
+				if (ToSeconds(deadline - start) <= s_Pacer.sleep_estimate)
+					break;
+
+				std::this_thread::sleep_for(SleepSlice);
+				RecordSleep(ToSeconds(Clock::now() - start));
+			}
+
+			while (Clock::now() < deadline)
+				std::this_thread::yield();
+		}
+	}
+
+	void FramePacer::Init()
+	{
+		#ifdef ENGINE_PLATFORM_WINDOWS
+			// The default 15.6ms timer resolution would turn most of every wait into spinning.
+			timeBeginPeriod(1);
+		#endif
+
+		s_Pacer.b_Started = false;
+	}
+
+	void FramePacer::Shutdown()
+	{
+		#ifdef ENGINE_PLATFORM_WINDOWS
+			timeEndPeriod(1);
+		#endif
+	}
+
+	void FramePacer::SetTargetFPS(double fps)
+	{
+		if (fps < 0.0)
+		{
+			INDY_CORE_ERROR("Invalid target FPS ({0}).", fps);
+			return;
+		}
+
+		s_Pacer.target_fps = fps;
+		s_Pacer.b_Started = false;
+	}
+
+	double FramePacer::GetTargetFPS()
+	{
+		return s_Pacer.target_fps;
+	}
+
+	void FramePacer::SetUnfocusedTimeout(double seconds)
+	{
+		s_Pacer.unfocused_timeout = seconds;
+	}
+
+	double FramePacer::GetUnfocusedTimeout()
+	{
+		return s_Pacer.unfocused_timeout;
+	}
+
+	void FramePacer::Wait()
+	{
+		if (s_Pacer.target_fps <= 0.0)
+			return;
+
+		Clock::duration period = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / s_Pacer.target_fps));
+		Clock::time_point now = Clock::now();
+
+		// Frames are scheduled on a fixed grid. After a long frame, the grid restarts from now
+		//	instead of rushing through the missed frames.
+		if (!s_Pacer.b_Started || now - s_Pacer.next_frame > period)
+		{
+			s_Pacer.next_frame = now + period;
+			s_Pacer.b_Started = true;
+		}
+
+		WaitUntil(s_Pacer.next_frame);
+		s_Pacer.next_frame += period;
+	}
+
+	void FramePacer::SleepPrecise(double seconds)
+	{
+		WaitUntil(Clock::now() + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(seconds)));
+	}
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "Core.h"
+
+namespace Engine
+{
+	/* Caps the frame rate of the main loop.
+	*	Wait() is called once at the end of every frame and blocks until the next frame is due. It
+	*	sleeps in short slices while the remaining time comfortably exceeds the expected sleep
+	*	duration, then spins for the rest, so frames start on time without burning a core. The
+	*	expected sleep duration is learned from the sleeps themselves (mean plus one standard
+	*	deviation), which adapts to the scheduler's timer resolution.
+	*
+	*	While the window is unfocused, platform windows block in glfwWaitEventsTimeout instead of
+	*	polling, for at most GetUnfocusedTimeout() seconds, so a background window idles until it
+	*	receives input.
+	*
+	*	Main thread only.
+	*/
+	class ENGINE_API FramePacer
+	{
+	public:
+		static void Init();
+		static void Shutdown();
+
+		// 0 leaves the frame rate uncapped. With a render thread, the Application starts it at the
+		//	display's refresh rate, since the swap no longer holds the main loop back.
+		static void SetTargetFPS(double fps);
+		static double GetTargetFPS();
+
+		static void SetUnfocusedTimeout(double seconds);
+		static double GetUnfocusedTimeout();
+
+		static void Wait();
+
+		// Blocks for the given number of seconds, using the same sleep-then-spin strategy as Wait.
+		static void SleepPrecise(double seconds);
+	};
+}
@@ -3,7 +3,7 @@
 // See https://github.com/gabime/spdlog for intended use of spdlog.
 
 #include "Core.h"
-#include "spdlog\spdlog.h"
+#include "spdlog/spdlog.h"
 
 namespace Engine
 {
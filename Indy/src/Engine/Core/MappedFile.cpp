@@ -0,0 +1,234 @@
+#include "MappedFile.h"
+#include "Log.h"
+
+#ifdef ENGINE_PLATFORM_WINDOWS
+	#ifndef WIN32_LEAN_AND_MEAN
+		#define WIN32_LEAN_AND_MEAN
+	#endif
+	#ifndef NOMINMAX
+		#define NOMINMAX
+	#endif
+	#include <Windows.h>
+#else
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+namespace Engine
+{
+	MappedFile::~MappedFile()
+	{
+		Close();
+	}
+
+#ifdef ENGINE_PLATFORM_WINDOWS
+
+	bool MappedFile::Open(const std::string& path, Access access, size_t size)
+	{
+		Close();
+
+		m_Access = access;
+
+		DWORD desiredAccess = access == Access::Read ? GENERIC_READ : GENERIC_READ | GENERIC_WRITE;
+		DWORD disposition = access == Access::Read ? OPEN_EXISTING : CREATE_ALWAYS;
+
+		HANDLE file = CreateFileA(path.c_str(), desiredAccess, FILE_SHARE_READ, nullptr, disposition, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (file == INVALID_HANDLE_VALUE)
+		{
+			INDY_CORE_ERROR("Could not open '{0}' for mapping (error {1}).", path, GetLastError());
+			return false;
+		}
+
+		m_File = file;
+
+		if (access == Access::Read)
+		{
+			LARGE_INTEGER fileSize;
+			GetFileSizeEx(file, &fileSize);
+			size = (size_t)fileSize.QuadPart;
+		}
+
+		m_Size = size;
+
+		if (!Map())
+		{
+			Close();
+			return false;
+		}
+
+		return true;
+	}
+
+	bool MappedFile::Resize(size_t size)
+	{
+		if (m_File == nullptr || m_Access != Access::ReadWrite)
+			return false;
+
+		Unmap();
+
+		// Mapping a larger size grows the file; shrinking needs an explicit truncation.
+		LARGE_INTEGER newSize;
+		newSize.QuadPart = (LONGLONG)size;
+
+		if (!SetFilePointerEx((HANDLE)m_File, newSize, nullptr, FILE_BEGIN) || !SetEndOfFile((HANDLE)m_File))
+		{
+			INDY_CORE_ERROR("Could not resize mapped file (error {0}).", GetLastError());
+			return false;
+		}
+
+		m_Size = size;
+		return Map();
+	}
+
+	void MappedFile::Close()
+	{
+		Unmap();
+
+		if (m_File != nullptr)
+			CloseHandle((HANDLE)m_File);
+
+		m_File = nullptr;
+		m_Size = 0;
+	}
+
+	bool MappedFile::Map()
+	{
+		// Empty files can't be mapped, but are still valid.
+		if (m_Size == 0)
+			return true;
+
+		DWORD protect = m_Access == Access::Read ? PAGE_READONLY : PAGE_READWRITE;
+		DWORD viewAccess = m_Access == Access::Read ? FILE_MAP_READ : FILE_MAP_WRITE;
+
+		HANDLE mapping = CreateFileMappingA((HANDLE)m_File, nullptr, protect, (DWORD)((uint64_t)m_Size >> 32), (DWORD)(m_Size & 0xFFFFFFFF), nullptr);
+		if (mapping == nullptr)
+		{
+			INDY_CORE_ERROR("Could not create file mapping (error {0}).", GetLastError());
+			return false;
+		}
+
+		m_Mapping = mapping;
+		m_Data = static_cast<uint8_t*>(MapViewOfFile(mapping, viewAccess, 0, 0, m_Size));
+
+		if (m_Data == nullptr)
+		{
+			INDY_CORE_ERROR("Could not map view of file (error {0}).", GetLastError());
+			return false;
+		}
+
+		return true;
+	}
+
+	void MappedFile::Unmap()
+	{
+		if (m_Data != nullptr)
+			UnmapViewOfFile(m_Data);
+
+		if (m_Mapping != nullptr)
+			CloseHandle((HANDLE)m_Mapping);
+
+		m_Data = nullptr;
+		m_Mapping = nullptr;
+	}
+
+#else
+
+	bool MappedFile::Open(const std::string& path, Access access, size_t size)
+	{
+		Close();
+
+		m_Access = access;
+
+		int flags = access == Access::Read ? O_RDONLY : O_RDWR | O_CREAT | O_TRUNC;
+		m_FileDescriptor = open(path.c_str(), flags, 0644);
+
+		if (m_FileDescriptor < 0)
+		{
+			INDY_CORE_ERROR("Could not open '{0}' for mapping.", path);
+			return false;
+		}
+
+		if (access == Access::Read)
+		{
+			struct stat fileStat;
+			fstat(m_FileDescriptor, &fileStat);
+			size = (size_t)fileStat.st_size;
+		}
+		else if (ftruncate(m_FileDescriptor, (off_t)size) != 0)
+		{
+			INDY_CORE_ERROR("Could not size '{0}' for mapping.", path);
+			Close();
+			return false;
+		}
+
+		m_Size = size;
+
+		if (!Map())
+		{
+			Close();
+			return false;
+		}
+
+		return true;
+	}
+
+	bool MappedFile::Resize(size_t size)
+	{
+		if (m_FileDescriptor < 0 || m_Access != Access::ReadWrite)
+			return false;
+
+		Unmap();
+
+		if (ftruncate(m_FileDescriptor, (off_t)size) != 0)
+		{
+			INDY_CORE_ERROR("Could not resize mapped file.");
+			return false;
+		}
+
+		m_Size = size;
+		return Map();
+	}
+
+	void MappedFile::Close()
+	{
+		Unmap();
+
+		if (m_FileDescriptor >= 0)
+			close(m_FileDescriptor);
+
+		m_FileDescriptor = -1;
+		m_Size = 0;
+	}
+
+	bool MappedFile::Map()
+	{
+		// Empty files can't be mapped, but are still valid.
+		if (m_Size == 0)
+			return true;
+
+		int protection = m_Access == Access::Read ? PROT_READ : PROT_READ | PROT_WRITE;
+		int flags = m_Access == Access::Read ? MAP_PRIVATE : MAP_SHARED;
+
+		void* data = mmap(nullptr, m_Size, protection, flags, m_FileDescriptor, 0);
+		if (data == MAP_FAILED)
+		{
+			INDY_CORE_ERROR("Could not map file.");
+			return false;
+		}
+
+		m_Data = static_cast<uint8_t*>(data);
+		return true;
+	}
+
+	void MappedFile::Unmap()
+	{
+		if (m_Data != nullptr)
+			munmap(m_Data, m_Size);
+
+		m_Data = nullptr;
+	}
+
+#endif
+}
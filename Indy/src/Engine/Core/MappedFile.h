@@ -0,0 +1,50 @@
+#pragma once
+
+#include "Core.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace Engine
+{
+	// A file mapped into memory. Read-only mappings map an existing file; read-write mappings
+	//	create (or truncate) the file and can be resized, which remaps it.
+	class ENGINE_API MappedFile
+	{
+	public:
+		enum class Access { Read, ReadWrite };
+
+		MappedFile() = default;
+		~MappedFile();
+
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+
+		// For ReadWrite access, size is the initial size of the new file. It is ignored for Read access.
+		bool Open(const std::string& path, Access access, size_t size = 0);
+
+		// Grows or shrinks a ReadWrite mapping. The data pointer may change.
+		bool Resize(size_t size);
+
+		void Close();
+
+		uint8_t* GetData() const { return m_Data; };
+		size_t GetSize() const { return m_Size; };
+		bool IsOpen() const { return m_Data != nullptr; };
+
+	private:
+		bool Map();
+		void Unmap();
+
+	private:
+		uint8_t* m_Data = nullptr;
+		size_t m_Size = 0;
+		Access m_Access = Access::Read;
+
+		// Platform handles: HANDLEs on Windows, a file descriptor elsewhere.
+		void* m_File = nullptr;
+		void* m_Mapping = nullptr;
+		int m_FileDescriptor = -1;
+	};
+}
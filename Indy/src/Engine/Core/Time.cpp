@@ -0,0 +1,138 @@
+#include "Time.h"
+#include "Log.h"
+
+#include <GLFW/glfw3.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace Engine
+{
+	namespace
+	{
+		constexpr double SmoothingFactor = 0.1;
+
+		struct TimeState
+		{
+			uint64_t frequency = 0;
+			uint64_t start = 0;
+			uint64_t last_frame = 0;
+
+			double delta = 0.0;
+			double smoothed_delta = 0.0;
+			uint64_t frame_index = 0;
+
+			double fixed_timestep = 1.0 / 60.0;
+			double accumulator = 0.0;
+			uint32_t fixed_steps = 0;
+		};
+
+		TimeState s_Time;
+	}
+
+	void Time::Init()
+	{
+		s_Time.frequency = glfwGetTimerFrequency();
+
+		if (s_Time.frequency == 0)
+		{
+			INDY_CORE_CRITICAL("Time was initialized before GLFW.");
+			return;
+		}
+
+		s_Time.start = glfwGetTimerValue();
+		s_Time.last_frame = s_Time.start;
+
+		s_Time.delta = 0.0;
+		s_Time.smoothed_delta = s_Time.fixed_timestep;
+		s_Time.frame_index = 0;
+		s_Time.accumulator = 0.0;
+	}
+
+	void Time::BeginFrame()
+	{
+		uint64_t now = glfwGetTimerValue();
+
+		if (s_Time.frequency != 0)
+			s_Time.delta = std::min((double)(now - s_Time.last_frame) / (double)s_Time.frequency, MaxDelta);
+
+		s_Time.last_frame = now;
+		s_Time.smoothed_delta += (s_Time.delta - s_Time.smoothed_delta) * SmoothingFactor;
+		s_Time.frame_index++;
+
+		s_Time.accumulator += s_Time.delta;
+		s_Time.fixed_steps = 0;
+	}
+
+	uint64_t Time::GetTicks()
+	{
+		return glfwGetTimerValue();
+	}
+
+	uint64_t Time::GetTickFrequency()
+	{
+		return s_Time.frequency;
+	}
+
+	double Time::GetTime()
+	{
+		if (s_Time.frequency == 0)
+			return 0.0;
+
+		return (double)(glfwGetTimerValue() - s_Time.start) / (double)s_Time.frequency;
+	}
+
+	double Time::GetDelta()
+	{
+		return s_Time.delta;
+	}
+
+	double Time::GetSmoothedDelta()
+	{
+		return s_Time.smoothed_delta;
+	}
+
+	uint64_t Time::GetFrameIndex()
+	{
+		return s_Time.frame_index;
+	}
+
+	void Time::SetFixedTimestep(double seconds)
+	{
+		if (seconds <= 0.0)
+		{
+			INDY_CORE_ERROR("Invalid fixed timestep ({0}s).", seconds);
+			return;
+		}
+
+		s_Time.fixed_timestep = seconds;
+	}
+
+	double Time::GetFixedTimestep()
+	{
+		return s_Time.fixed_timestep;
+	}
+
+	bool Time::StepFixed()
+	{
+		if (s_Time.accumulator < s_Time.fixed_timestep)
+			return false;
+
+		if (s_Time.fixed_steps == MaxFixedStepsPerFrame)
+		{
+			// The simulation can't keep up; drop whole steps rather than falling further behind.
+			s_Time.accumulator = std::fmod(s_Time.accumulator, s_Time.fixed_timestep);
+			return false;
+		}
+
+		s_Time.accumulator -= s_Time.fixed_timestep;
+		s_Time.fixed_steps++;
+
+		return true;
+	}
+
+	double Time::GetAlpha()
+	{
+		return std::clamp(s_Time.accumulator / s_Time.fixed_timestep, 0.0, 1.0);
+	}
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "Core.h"
+
+#include <cstdint>
+
+namespace Engine
+{
+	/* Frame clock and fixed-timestep accumulator.
+	*	Built on GLFW's timer (QueryPerformanceCounter on Windows, clock_gettime(CLOCK_MONOTONIC)
+	*	elsewhere), so GLFW must be initialized first; the Application initializes Time right after
+	*	creating its window.
+	*
+	*	BeginFrame is called once at the top of every frame. It measures the frame delta (clamped to
+	*	MaxDelta, so a breakpoint or a stalled frame doesn't produce a huge step) and adds it to the
+	*	fixed-timestep accumulator. StepFixed then consumes the accumulator one fixed step at a time:
+	*
+	*		while (Time::StepFixed())
+	*			Simulate(Time::GetFixedTimestep());
+	*
+	*		Render(Time::GetAlpha()); // Interpolate between the last two simulation states.
+	*
+	*	Main thread only.
+	*/
+	class ENGINE_API Time
+	{
+	public:
+		static constexpr double MaxDelta = 0.25;
+		static constexpr uint32_t MaxFixedStepsPerFrame = 8;
+
+		static void Init();
+		static void BeginFrame();
+
+		// Raw monotonic clock.
+		static uint64_t GetTicks();
+		static uint64_t GetTickFrequency();
+
+		// Seconds since Init.
+		static double GetTime();
+
+		// Seconds since the previous frame, raw and exponentially smoothed.
+		static double GetDelta();
+		static double GetSmoothedDelta();
+
+		// Number of frames begun since Init. The first frame is frame 1.
+		static uint64_t GetFrameIndex();
+
+		static void SetFixedTimestep(double seconds);
+		static double GetFixedTimestep();
+
+		// Consumes one fixed step from the accumulator. Returns false once less than a step is left,
+		//	or after MaxFixedStepsPerFrame steps this frame, in which case the excess time is dropped.
+		static bool StepFixed();
+
+		// How far the accumulator is into the next fixed step, from 0 to 1.
+		static double GetAlpha();
+	};
+}
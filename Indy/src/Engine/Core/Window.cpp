@@ -1,20 +1,15 @@
 #include "Window.h"
-#include "Log.h"
 
-#ifdef ENGINE_PLATFORM_WINDOWS
-	#include "Engine/Platform/Windows/WindowsWindow.h"
-#endif // ENGINE_PLATFORM_WINDOWS
+#include "Engine/Platform/GLFW/GLFWWindow.h"
+#include "Engine/Platform/Headless/HeadlessWindow.h"
 
 namespace Engine
 {
 	std::unique_ptr<Window> Window::Create(const WindowSpec& spec)
 	{
-		#ifdef ENGINE_PLATFORM_WINDOWS
-			return std::make_unique<WindowsWindow>(spec);
-		return nullptr;
-		#else
-			INDY_CORE_CRITICAL("Window Could Not Be Created: 'Platform Not Supported'")
-			return nullptr;
-		#endif
+		if (spec.b_Headless)
+			return std::make_unique<HeadlessWindow>(spec);
+
+		return std::make_unique<GLFWWindow>(spec);
 	}
 }
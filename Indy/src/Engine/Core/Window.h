@@ -1,6 +1,8 @@
 #pragma once
 
 #include "Core.h"
+#include "Engine/Renderer/RenderThread.h"
+
 #include <iostream>
 #include <memory>
 
@@ -11,6 +13,12 @@ namespace Engine
 		std::string title;
 		unsigned int width, height;
 
+		// Creates a HeadlessWindow instead of the platform's window, for machines without a display or GPU.
+		bool b_Headless = false;
+
+		// Draws on a dedicated render thread. When false, frames are drawn on the main thread (see RenderThread).
+		bool b_RenderThread = true;
+
 		WindowSpec(const std::string& Title = "Indy Engine", unsigned int Width = 1280, unsigned int Height = 720)
 			: title(Title), width(Width), height(Height) {};
 	};
@@ -21,11 +29,22 @@ namespace Engine
 	public:
 		virtual ~Window() = default;
 
+		// Polls OS events. Called at the top of every frame, before the simulation.
 		virtual void onUpdate() = 0;
 
+		// False if the window couldn't be opened, or has been closed since.
+		virtual bool IsOpen() const = 0;
+
+		// The packet the main thread fills for this frame. It's drawn once submitted (see RenderThread).
+		virtual FramePacket& BeginFramePacket() = 0;
+		virtual void SubmitFramePacket() = 0;
+
 		virtual uint32_t GetWidth() const = 0;
 		virtual uint32_t GetHeight() const = 0;
 
+		// Refresh rate of the display the window is shown on, in Hz, or 0 if it isn't known.
+		virtual double GetRefreshRate() const = 0;
+
 		static std::unique_ptr<Window> Create(const WindowSpec& spec = WindowSpec());
 	};
 }
\ No newline at end of file
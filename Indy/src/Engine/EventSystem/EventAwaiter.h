@@ -0,0 +1,143 @@
+#pragma once
+
+#include "EventChannel.h"
+
+#include <coroutine>
+#include <optional>
+
+/* Awaitable for the next dispatch of an event type (see Events::Next).
+*	A suspended coroutine is linked into its event container through the awaiter, which lives in the
+*	coroutine frame, so waiting never allocates. When the next event is dispatched and no listener
+*	handles it, the container copies the event into each waiting awaiter and resumes its coroutine,
+*	from inside the dispatch. Waiting coroutines are resumed in no particular order.
+*
+*	An awaiter can be restricted to one channel (see EventChannel.h). Destroying a suspended coroutine
+*	unlinks its awaiter, so it's never resumed.
+*/
+template<typename T_Event_Type>
+class EventAwaiter
+{
+public:
+	EventAwaiter(EventAwaiter** list)
+		: m_List(list) {};
+
+	EventAwaiter(EventAwaiter** list, EventChannel channel)
+		: m_List(list), m_Channel(channel), b_AnyChannel(false) {};
+
+	EventAwaiter(const EventAwaiter&) = delete;
+	EventAwaiter& operator=(const EventAwaiter&) = delete;
+
+	~EventAwaiter()
+	{
+		unlink();
+	}
+
+	bool await_ready() const noexcept { return false; };
+
+	void await_suspend(std::coroutine_handle<> handle)
+	{
+		m_Handle = handle;
+		link(m_List);
+	}
+
+	T_Event_Type await_resume()
+	{
+		return std::move(*m_Event);
+	}
+
+	// Resumes every awaiter in a list that accepts the event. Awaiters that don't are moved back to
+	//	the list. Coroutines may await the same event type again, or destroy other waiting coroutines,
+	//	while this runs. Returns false if no awaiter was resumed.
+	static bool resumeAll(EventAwaiter** list, const T_Event_Type& event)
+	{
+		if (*list == nullptr)
+			return false;
+
+		// Detached first, so coroutines that await again wait for the next event.
+		EventAwaiter* pending = nullptr;
+		while (*list != nullptr)
+		{
+			EventAwaiter* awaiter = *list;
+			awaiter->unlink();
+			awaiter->link(&pending);
+		}
+
+		bool b_Resumed = false;
+		while (pending != nullptr)
+		{
+			EventAwaiter* awaiter = pending;
+			awaiter->unlink();
+
+			if (!awaiter->b_AnyChannel && !accepts(awaiter->m_Channel, event))
+			{
+				awaiter->link(list);
+				continue;
+			}
+
+			awaiter->m_Event.emplace(event);
+			awaiter->m_Handle.resume();
+			b_Resumed = true;
+		}
+
+		return b_Resumed;
+	}
+
+	// Destroys every coroutine waiting in a list.
+	static void destroyAll(EventAwaiter** list)
+	{
+		while (*list != nullptr)
+			(*list)->m_Handle.destroy();
+	}
+
+private:
+	static bool accepts(EventChannel channel, const T_Event_Type& event)
+	{
+		if constexpr (HasEventChannel<T_Event_Type>())
+			return event.getChannel() == channel;
+		else
+			return false;
+	}
+
+	void link(EventAwaiter** head)
+	{
+		m_Head = head;
+		m_Prev = nullptr;
+		m_Next = *head;
+
+		if (m_Next != nullptr)
+			m_Next->m_Prev = this;
+
+		*head = this;
+	}
+
+	void unlink()
+	{
+		if (m_Head == nullptr)
+			return;
+
+		if (m_Prev != nullptr)
+			m_Prev->m_Next = m_Next;
+		else
+			*m_Head = m_Next;
+
+		if (m_Next != nullptr)
+			m_Next->m_Prev = m_Prev;
+
+		m_Head = nullptr;
+		m_Prev = nullptr;
+		m_Next = nullptr;
+	}
+
+private:
+	// The container's list this awaiter will wait in, and the list it's currently linked into.
+	EventAwaiter** m_List;
+	EventAwaiter** m_Head = nullptr;
+	EventAwaiter* m_Prev = nullptr;
+	EventAwaiter* m_Next = nullptr;
+
+	EventChannel m_Channel = 0;
+	bool b_AnyChannel = true;
+
+	std::coroutine_handle<> m_Handle;
+	std::optional<T_Event_Type> m_Event;
+};
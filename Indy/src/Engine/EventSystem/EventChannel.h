@@ -0,0 +1,29 @@
+#pragma once
+
+#include <concepts>
+#include <cstdint>
+
+/* Event channels.
+*	An event type can be split into channels (e.g. one per window) by defining:
+*		EventChannel getChannel() const;
+*
+*	Listeners bound to a channel (see Events::BindChannel) only receive events whose getChannel()
+*	matches. Each channel has its own listener list, found through a hash lookup on dispatch, so
+*	dispatching to a channel only costs as much as the listeners interested in it. Channel listeners
+*	are invoked before the type's global listeners and can stop them from receiving the event.
+*/
+
+using EventChannel = uint64_t;
+
+// Channel keyed by an object's address, e.g. a window handle.
+template<typename T_Object>
+EventChannel MakeEventChannel(const T_Object* object)
+{
+	return (EventChannel)(uintptr_t)object;
+}
+
+template<typename T_Event_Type>
+constexpr bool HasEventChannel()
+{
+	return requires(const T_Event_Type& event) { { event.getChannel() } -> std::convertible_to<EventChannel>; };
+}
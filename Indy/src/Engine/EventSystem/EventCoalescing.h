@@ -0,0 +1,104 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+/* Coalescing policies for high-frequency events.
+*	Deferred dispatchers (the event queues and the frame event stream) merge runs of events of the
+*	same type before dispatching them, so listeners see one merged event instead of every raw one.
+*	Immediate dispatch (Events::Dispatch) never coalesces.
+*
+*	Events opt in by declaring a policy:
+*		static constexpr EventCoalescePolicy CoalescePolicy = EventCoalescePolicy::KeepLast;
+*
+*	Accumulate events must also define "void accumulate(const T& next)", which folds the next event
+*	into this one. Events may define "bool coalescesWith(const T& next) const" to restrict which
+*	events are merged (e.g. only events from the same window). Otherwise, any two events merge.
+*/
+
+enum class EventCoalescePolicy : uint8_t
+{
+	None,		// Every event is dispatched.
+	KeepLast,	// A run of events is replaced by its last event.
+	Accumulate	// A run of events is folded into its first event with accumulate().
+};
+
+template<typename T_Event_Type>
+constexpr EventCoalescePolicy GetEventCoalescePolicy()
+{
+	if constexpr (requires { T_Event_Type::CoalescePolicy; })
+		return T_Event_Type::CoalescePolicy;
+	else
+		return EventCoalescePolicy::None;
+}
+
+// Raw vs. dispatched event counts for deferred dispatch of a single event type.
+struct EventCoalesceStats
+{
+	uint64_t received = 0;
+	uint64_t dispatched = 0;
+
+	uint64_t folded() const { return received - dispatched; };
+};
+
+template<typename T_Event_Type>
+struct EventCoalescer
+{
+	static constexpr EventCoalescePolicy Policy = GetEventCoalescePolicy<T_Event_Type>();
+
+	static_assert(Policy != EventCoalescePolicy::Accumulate || requires(T_Event_Type a, const T_Event_Type& b) { a.accumulate(b); },
+		"Events with the Accumulate coalesce policy must define 'void accumulate(const T& next)'.");
+
+	// Folds next into pending if the policy allows it. Returns false if the two events must both be dispatched.
+	static bool fold(T_Event_Type& pending, T_Event_Type& next)
+	{
+		if constexpr (Policy == EventCoalescePolicy::None)
+		{
+			return false;
+		}
+		else
+		{
+			if constexpr (requires { pending.coalescesWith(next); })
+			{
+				if (!pending.coalescesWith(next))
+					return false;
+			}
+
+			if constexpr (Policy == EventCoalescePolicy::KeepLast)
+				pending = std::move(next);
+			else
+				pending.accumulate(next);
+
+			return true;
+		}
+	}
+
+	// Coalesces a contiguous run of events in place, returning the number of events left.
+	static size_t fold(T_Event_Type* events, size_t count, EventCoalesceStats& stats)
+	{
+		stats.received += count;
+
+		if constexpr (Policy != EventCoalescePolicy::None)
+		{
+			if (count > 1)
+			{
+				size_t last = 0;
+
+				for (size_t i = 1; i < count; i++)
+				{
+					if (fold(events[last], events[i]))
+						continue;
+
+					if (++last != i)
+						events[last] = std::move(events[i]);
+				}
+
+				count = last + 1;
+			}
+		}
+
+		stats.dispatched += count;
+		return count;
+	}
+};
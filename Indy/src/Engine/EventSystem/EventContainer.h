@@ -1,62 +1,396 @@
 #pragma once
 
 #include "EventHandle.h"
+#include "EventDelegate.h"
+#include "EventAwaiter.h"
+#include "EventChannel.h"
+#include "EventCoalescing.h"
+#include "EventPriority.h"
 #include "Engine/Core/Log.h"
+#include "Engine/Jobs/Jobs.h"
 
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <unordered_map>
 #include <vector>
-#include <functional>
 
 template<typename T_Event_Type>
 struct EventContainer : EventContainerBase
 {
-	using EventCallback_Fn = std::function<void(const T_Event_Type&)>;
+	using EventCallback_Fn = EventDelegate<T_Event_Type>;
 
-	std::vector<EventCallback_Fn> callbacks;
-	std::vector<uint32_t> free_callbacks;
+	static constexpr uint32_t InvalidIndex = UINT32_MAX;
+	static constexpr uint32_t PendingFlag = 0x80000000;
 
-	// Subscribes to an Event, returning a new EventHandle
-	EventHandle addCallback(const EventCallback_Fn& callback)
+	// Live listeners, packed contiguously and sorted in dispatch order (see EventPriority) before each
+	//	dispatch. Removed listeners are flagged by an invalid slot and stay in place until the next
+	//	compaction, which only runs outside of dispatch.
+	struct Listener
 	{
-		bool b_HasFreeIndex = !free_callbacks.empty();
+		EventCallback_Fn callback;
+		uint32_t slot;
+		uint32_t order_key;
+		bool b_Independent;
+	};
 
-		// Replace free callback indexed first.
-		uint32_t free_index = b_HasFreeIndex ? free_callbacks.back() : callbacks.size();
-		EventHandle handle{ free_index, this };
+	// Handles refer to slots, which track where their listener currently is.
+	struct Slot
+	{
+		uint32_t generation = 0;
+		uint32_t listener = InvalidIndex;
+	};
+
+	std::vector<Listener> listeners;
+	uint32_t removed_listeners = 0;
+
+	// Listeners past this index were added since the last dispatch, in registration order, and are
+	//	merged into the sorted ones by the next dispatch. sort_buffer is kept to merge into.
+	uint32_t sorted_listeners = 0;
+	std::vector<Listener> sort_buffer;
+	uint32_t independent_listeners = 0;
+
+	/* Re-entrancy:
+			Listeners may bind, unbind and dispatch from inside a dispatch. While dispatch_depth is
+			non-zero the listeners vector is never resized or reordered: new listeners go to
+			pending_listeners, and removed listeners are only flagged (their callback may still be
+			running). Pending listeners are inserted once the outermost dispatch completes, and are
+			first invoked by the next dispatch.
+	*/
+	uint32_t dispatch_depth = 0;
+	std::vector<Listener> pending_listeners;
 
-		if (b_HasFreeIndex)
-			free_callbacks.pop_back();
+	// Slots are recycled through free_slots, so the slot vector never grows past the peak number of live listeners.
+	std::vector<Slot> slots;
+	std::vector<uint32_t> free_slots;
 
-		callbacks.emplace_back(callback);
+	// Updated by deferred dispatchers (queue and stream) when they coalesce events of this type.
+	EventCoalesceStats coalesce_stats;
 
-		return handle;
+	// Listeners scoped to a channel (see EventChannel.h), one container per channel. Channel containers
+	//	are never destroyed, since handles to their listeners point at them.
+	std::unordered_map<EventChannel, std::unique_ptr<EventContainer>> channels;
+
+	// The container a channel container belongs to, null otherwise. Channel listeners are timed into
+	//	its stats, since only registered containers are reported.
+	EventContainer* parent = nullptr;
+
+	// Coroutines suspended on Events::Next for this type. See EventAwaiter.h.
+	EventAwaiter<T_Event_Type>* awaiters = nullptr;
+
+	EventContainer()
+	{
+		event_size = (uint32_t)sizeof(T_Event_Type);
 	}
 
-	// Removes an event, given an EventHandle. Returns true if the operation was successful
+	~EventContainer() override
+	{
+		EventAwaiter<T_Event_Type>::destroyAll(&awaiters);
+	}
+
+	// Subscribes to an Event, returning a new EventHandle. O(1): the listener is appended, and only
+	//	sorted into place by the next dispatch.
+	EventHandle addCallback(EventCallback_Fn callback, EventPriority priority = {})
+	{
+		uint32_t index;
+
+		if (!free_slots.empty())
+		{
+			index = free_slots.back();
+			free_slots.pop_back();
+		}
+		else
+		{
+			index = (uint32_t)slots.size();
+			slots.emplace_back();
+		}
+
+		Listener listener{ std::move(callback), index, priority.getOrderKey(), priority.b_Independent };
+
+		if (dispatch_depth == 0)
+		{
+			// Removed listeners are dropped first, so bind/unbind churn between dispatches can't grow the vector.
+			compact();
+			appendListener(std::move(listener));
+		}
+		else
+		{
+			slots[index].listener = PendingFlag | (uint32_t)pending_listeners.size();
+			pending_listeners.push_back(std::move(listener));
+		}
+
+		return EventHandle{ index, slots[index].generation, this };
+	}
+
+	// Removes an event, given an EventHandle. O(1). Returns false if the handle is stale or doesn't belong to this container.
 	bool removeCallback(const EventHandle& handle) override
 	{
-		if (callbacks[handle.event_id] == nullptr)
+		if (handle.container != this || handle.index >= slots.size() || slots[handle.index].generation != handle.generation)
 		{
-			free_callbacks.emplace_back(handle.event_id);
+			#ifdef ENGINE_DEBUG
+				INDY_CORE_WARN("Attempted to remove an event listener with a stale handle (slot {0}, generation {1}).", handle.index, handle.generation);
+			#endif
 			return false;
 		}
 
-		callbacks[handle.event_id] = nullptr;
-		free_callbacks.emplace_back(handle.event_id);
+		Slot& slot = slots[handle.index];
+
+		if (slot.listener & PendingFlag)
+		{
+			pending_listeners[slot.listener & ~PendingFlag].slot = InvalidIndex;
+		}
+		else
+		{
+			Listener& listener = listeners[slot.listener];
+			listener.slot = InvalidIndex;
+			removed_listeners++;
+
+			if (listener.b_Independent)
+				independent_listeners--;
+		}
+
+		slot.listener = InvalidIndex;
+		slot.generation++;
+		free_slots.emplace_back(handle.index);
 
 		return true;
 	}
 
-	// Invokes callbacks in reverse order. Callbacks registered first will be invoked last.
-	void invokeCallbacks(const T_Event_Type& event) const
+	// Returns the container holding the listeners of a channel, creating it if needed.
+	EventContainer& getChannel(EventChannel channel)
 	{
-		for (auto it = callbacks.rbegin(); it != callbacks.rend(); ++it)
+		std::unique_ptr<EventContainer>& container = channels[channel];
+
+		if (container == nullptr)
 		{
-			EventCallback_Fn callback = *it;
+			container = std::make_unique<EventContainer>();
+			container->parent = this;
+		}
+
+		return *container;
+	}
+
+	uint32_t getListenerCount() const override
+	{
+		uint32_t count = (uint32_t)listeners.size() - removed_listeners;
+		for (const Listener& listener : pending_listeners)
+			count += listener.slot != InvalidIndex;
+
+		for (const auto& [channel, container] : channels)
+			count += container->getListenerCount();
+
+		return count;
+	}
+
+	// Destroys removed listeners, preserving the order of live listeners. Never called during dispatch.
+	void compact()
+	{
+		if (removed_listeners == 0)
+			return;
 
-			if (callback == nullptr)
+		uint32_t live = 0;
+		uint32_t sorted = 0;
+		for (uint32_t i = 0; i < (uint32_t)listeners.size(); i++)
+		{
+			if (listeners[i].slot == InvalidIndex)
 				continue;
 
-			callback(event);
+			if (live != i)
+				listeners[live] = std::move(listeners[i]);
+
+			slots[listeners[live].slot].listener = live;
+			sorted += i < sorted_listeners;
+			live++;
+		}
+
+		listeners.resize(live);
+		removed_listeners = 0;
+		sorted_listeners = sorted;
+	}
+
+	// Sorts the listeners added since the last dispatch into dispatch order. Equal keys keep later
+	//	registrations first: the new listeners are sorted newest first, then merged ahead of sorted
+	//	listeners with the same key. O(n) plus the sort of the new listeners; never called during dispatch.
+	void sortListeners()
+	{
+		if (sorted_listeners == (uint32_t)listeners.size())
+			return;
+
+		auto byKey = [](const Listener& a, const Listener& b) { return a.order_key < b.order_key; };
+
+		auto sorted = listeners.begin() + sorted_listeners;
+		std::reverse(sorted, listeners.end());
+		std::stable_sort(sorted, listeners.end(), byKey);
+
+		sort_buffer.clear();
+		sort_buffer.reserve(listeners.size());
+		std::merge(std::make_move_iterator(sorted), std::make_move_iterator(listeners.end()),
+			std::make_move_iterator(listeners.begin()), std::make_move_iterator(sorted), std::back_inserter(sort_buffer), byKey);
+
+		listeners.swap(sort_buffer);
+		sort_buffer.clear();
+
+		for (uint32_t i = 0; i < (uint32_t)listeners.size(); i++)
+		{
+			if (listeners[i].slot != InvalidIndex)
+				slots[listeners[i].slot].listener = i;
+		}
+
+		sorted_listeners = (uint32_t)listeners.size();
+	}
+
+	// Invokes callbacks in dispatch order until one of them handles the event. Listeners bound to the
+	//	event's channel go first, coroutines awaiting the event last. Listeners are compacted and sorted
+	//	first, so dispatch only touches live listeners, in order.
+	//	When two or more independent listeners are bound and the job system is running, they are
+	//	skipped by the ordered pass and fanned out across the job workers afterwards.
+	//	Returns true if the event was handled.
+	bool invokeCallbacks(const T_Event_Type& event)
+	{
+		if (record != nullptr)
+			record(type_id, &event, sizeof(T_Event_Type));
+
+		#if ENGINE_EVENT_STATS
+			EventStatsClock::time_point dispatchStart = EventStatsClock::now();
+		#endif
+
+		if (dispatch_depth == 0)
+		{
+			compact();
+			sortListeners();
+		}
+
+		dispatch_depth++;
+
+		bool b_Handled = false;
+
+		if constexpr (HasEventChannel<T_Event_Type>())
+		{
+			if (!channels.empty())
+			{
+				auto it = channels.find(event.getChannel());
+				if (it != channels.end())
+					b_Handled = it->second->invokeCallbacks(event);
+			}
+		}
+
+		bool b_Parallel = !b_Handled && independent_listeners > 1 && Engine::Jobs::IsRunning();
+
+		for (size_t i = 0, count = listeners.size(); i < count && !b_Handled; i++)
+		{
+			const Listener& listener = listeners[i];
+
+			if (listener.slot != InvalidIndex && !(b_Parallel && listener.b_Independent))
+				b_Handled = invokeListener(listener, event);
+		}
+
+		if (b_Parallel && !b_Handled)
+			invokeIndependentCallbacks(event);
+
+		// Waiting coroutines resume last, still inside the dispatch, so they may bind, unbind and dispatch like listeners.
+		if (!b_Handled && awaiters != nullptr)
+			EventAwaiter<T_Event_Type>::resumeAll(&awaiters, event);
+
+		if (--dispatch_depth == 0 && !pending_listeners.empty())
+			insertPendingListeners();
+
+		#if ENGINE_EVENT_STATS
+			// A channel's dispatch is already part of its parent's.
+			if (parent == nullptr)
+				stats.recordDispatch(GetEventStatsElapsed(dispatchStart));
+		#endif
+
+		return b_Handled;
+	}
+
+	bool invokeListener(const Listener& listener, const T_Event_Type& event)
+	{
+		#if ENGINE_EVENT_STATS
+			// The listener may remove itself, so its slot is read before it runs.
+			uint32_t slot = listener.slot;
+			uint32_t generation = slots[slot].generation;
+
+			EventStatsClock::time_point start = EventStatsClock::now();
+			bool b_Handled = listener.callback(event);
+			EventDispatchStats& target = parent != nullptr ? parent->stats : stats;
+			target.recordListener(GetEventStatsElapsed(start), slot, generation, this);
+
+			return b_Handled;
+		#else
+			return listener.callback(event);
+		#endif
+	}
+
+	void invokeIndependentCallbacks(const T_Event_Type& event)
+	{
+		struct ParallelDispatch
+		{
+			const EventContainer* container;
+			const T_Event_Type* event;
+		};
+
+		ParallelDispatch dispatch{ this, &event };
+
+		// One listener per batch: independent listeners are expected to do real work.
+		Engine::Jobs::ParallelFor(listeners.size(), 1, [](void* context, size_t begin, size_t end)
+		{
+			const ParallelDispatch& dispatch = *static_cast<const ParallelDispatch*>(context);
+
+			for (size_t i = begin; i < end; i++)
+			{
+				const Listener& listener = dispatch.container->listeners[i];
+
+				if (listener.b_Independent && listener.slot != InvalidIndex)
+					listener.callback(*dispatch.event);
+			}
+		}, &dispatch);
+	}
+
+	// Appends a listener past the sorted ones. See sortListeners.
+	void appendListener(Listener&& listener)
+	{
+		if (listener.b_Independent)
+			independent_listeners++;
+
+		slots[listener.slot].listener = (uint32_t)listeners.size();
+		listeners.push_back(std::move(listener));
+	}
+
+	void insertPendingListeners()
+	{
+		for (Listener& listener : pending_listeners)
+		{
+			if (listener.slot != InvalidIndex)
+				appendListener(std::move(listener));
+		}
+
+		pending_listeners.clear();
+	}
+
+	// The bytes are copied out first, since raw event data (e.g. from a mapped file) may not be aligned.
+	bool invokeRaw(const void* data) override
+	{
+		if constexpr (std::is_trivially_copyable_v<T_Event_Type>)
+		{
+			alignas(T_Event_Type) std::byte storage[sizeof(T_Event_Type)];
+			std::memcpy(storage, data, sizeof(T_Event_Type));
+
+			return invokeCallbacks(*std::launder(reinterpret_cast<const T_Event_Type*>(storage)));
+		}
+		else
+		{
+			return false;
 		}
 	}
+
+	// Invokes callbacks once for every event in a batch, in order.
+	void invokeCallbacks(std::span<const T_Event_Type> events)
+	{
+		for (const T_Event_Type& event : events)
+			invokeCallbacks(event);
+	}
 };
\ No newline at end of file
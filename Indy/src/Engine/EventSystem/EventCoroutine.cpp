@@ -0,0 +1,83 @@
+#include "EventCoroutine.h"
+
+#include <cstdint>
+#include <new>
+#include <vector>
+
+namespace
+{
+	constexpr size_t MinBlockSize = 64;
+	constexpr uint32_t SizeClassCount = 7; // 64 bytes to EventCoroutinePool::MaxFrameSize
+	constexpr size_t ChunkSize = 64 * 1024;
+
+	struct FreeBlock
+	{
+		FreeBlock* next;
+	};
+
+	// Constant-initialized, so it outlives the event registry, which destroys waiting coroutines on shutdown.
+	struct CoroutinePoolState
+	{
+		FreeBlock* free_lists[SizeClassCount] = {};
+		std::vector<void*> chunks;
+
+		~CoroutinePoolState()
+		{
+			for (void* chunk : chunks)
+				::operator delete(chunk, std::align_val_t(MinBlockSize));
+		}
+	};
+
+	CoroutinePoolState s_Pool;
+
+	uint32_t GetSizeClass(size_t size)
+	{
+		uint32_t sizeClass = 0;
+		for (size_t blockSize = MinBlockSize; blockSize < size; blockSize <<= 1)
+			sizeClass++;
+
+		return sizeClass;
+	}
+
+	void AllocateChunk(uint32_t sizeClass)
+	{
+		size_t blockSize = MinBlockSize << sizeClass;
+		std::byte* chunk = static_cast<std::byte*>(::operator new(ChunkSize, std::align_val_t(MinBlockSize)));
+		s_Pool.chunks.push_back(chunk);
+
+		FreeBlock*& list = s_Pool.free_lists[sizeClass];
+		for (size_t offset = ChunkSize; offset >= blockSize; offset -= blockSize)
+		{
+			FreeBlock* block = ::new (chunk + offset - blockSize) FreeBlock{ list };
+			list = block;
+		}
+	}
+}
+
+void* EventCoroutinePool::Allocate(size_t size)
+{
+	if (size > MaxFrameSize)
+		return ::operator new(size);
+
+	uint32_t sizeClass = GetSizeClass(size);
+
+	if (s_Pool.free_lists[sizeClass] == nullptr)
+		AllocateChunk(sizeClass);
+
+	FreeBlock* block = s_Pool.free_lists[sizeClass];
+	s_Pool.free_lists[sizeClass] = block->next;
+
+	return block;
+}
+
+void EventCoroutinePool::Free(void* frame, size_t size)
+{
+	if (size > MaxFrameSize)
+	{
+		::operator delete(frame);
+		return;
+	}
+
+	FreeBlock*& list = s_Pool.free_lists[GetSizeClass(size)];
+	list = ::new (frame) FreeBlock{ list };
+}
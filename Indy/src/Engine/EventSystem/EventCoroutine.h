@@ -0,0 +1,53 @@
+#pragma once
+
+#include "Engine/Core/Core.h"
+
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+
+/* Coroutine support for events.
+*	A function returning EventTask is a coroutine that starts immediately and runs until its first
+*	co_await, e.g.:
+*
+*		EventTask WaitForResize()
+*		{
+*			WindowResizeEvent event = co_await Events::Next<WindowResizeEvent>();
+*			...
+*		}
+*
+*	Awaiting an event suspends the coroutine until the next dispatch of that type (see EventAwaiter).
+*	Tasks are fire-and-forget: the frame is freed when the coroutine returns, or when the event
+*	system shuts down while it's still waiting.
+*
+*	Coroutine frames come from EventCoroutinePool rather than the heap. Coroutines are resumed by
+*	the dispatcher, so they run on the main thread and must be started there.
+*/
+
+// Size-classed free lists for coroutine frames. Frames up to MaxFrameSize are pooled, larger ones
+//	fall back to the heap. Blocks are carved from chunks that are kept until shutdown. Main thread only.
+class ENGINE_API EventCoroutinePool
+{
+public:
+	static constexpr size_t MaxFrameSize = 4096;
+
+	static void* Allocate(size_t size);
+	static void Free(void* frame, size_t size);
+};
+
+struct EventTask
+{
+	struct promise_type
+	{
+		EventTask get_return_object() { return {}; };
+
+		std::suspend_never initial_suspend() noexcept { return {}; };
+		std::suspend_never final_suspend() noexcept { return {}; };
+
+		void return_void() {};
+		void unhandled_exception() { std::terminate(); };
+
+		static void* operator new(size_t size) { return EventCoroutinePool::Allocate(size); };
+		static void operator delete(void* frame, size_t size) { EventCoroutinePool::Free(frame, size); };
+	};
+};
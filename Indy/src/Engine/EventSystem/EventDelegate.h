@@ -0,0 +1,186 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/* A fixed-size, non-allocating replacement for std::function<void(const T_Event_Type&)>.
+*	Member-function + instance pairs, free functions and small lambdas are stored inline. Invoking
+*	a delegate calls straight through a single function pointer; the stored callable is never copied.
+*	Callables that don't fit in the inline storage are rejected at compile time.
+*
+*	Callables may return bool instead of void. Returning true marks the event as handled, which stops
+*	it from propagating to the remaining listeners. Void callables never handle the event.
+*/
+
+template<typename T_Event_Type>
+class EventDelegate
+{
+public:
+	// Large enough for an instance pointer plus any pointer-to-member-function representation.
+	static constexpr size_t StorageSize = 4 * sizeof(void*);
+
+private:
+	enum class StorageOp { Copy, Move, Destroy };
+
+	using Invoke_Fn = bool(*)(void* storage, const T_Event_Type& event);
+	using Manage_Fn = void(*)(StorageOp op, void* dst, void* src);
+
+	template<typename T_Callable>
+	static bool Invoke(void* storage, const T_Event_Type& event)
+	{
+		if constexpr (std::is_same_v<std::invoke_result_t<T_Callable&, const T_Event_Type&>, bool>)
+		{
+			return (*static_cast<T_Callable*>(storage))(event);
+		}
+		else
+		{
+			(*static_cast<T_Callable*>(storage))(event);
+			return false;
+		}
+	}
+
+	// Only used for callables that aren't trivially copyable. Trivial callables are memcpy'd.
+	template<typename T_Callable>
+	static void Manage(StorageOp op, void* dst, void* src)
+	{
+		T_Callable* source = static_cast<T_Callable*>(src);
+
+		switch (op)
+		{
+			case StorageOp::Copy:
+				::new (dst) T_Callable(*source);
+				break;
+			case StorageOp::Move:
+				::new (dst) T_Callable(std::move(*source));
+				source->~T_Callable();
+				break;
+			case StorageOp::Destroy:
+				source->~T_Callable();
+				break;
+		}
+	}
+
+public:
+	EventDelegate() = default;
+	EventDelegate(std::nullptr_t) {};
+
+	template<typename T_Callable,
+		typename = std::enable_if_t<!std::is_same_v<std::decay_t<T_Callable>, EventDelegate>>>
+	EventDelegate(T_Callable&& callable)
+	{
+		using Callable = std::decay_t<T_Callable>;
+
+		static_assert(sizeof(Callable) <= StorageSize, "Event callback is too large for inline storage. Capture by reference or pointer instead.");
+		static_assert(alignof(Callable) <= alignof(std::max_align_t), "Event callback is over-aligned.");
+		static_assert(std::is_invocable_v<Callable&, const T_Event_Type&>, "Event callback must be invocable with 'const T_Event_Type&'.");
+
+		::new (static_cast<void*>(m_Storage)) Callable(std::forward<T_Callable>(callable));
+		m_Invoke = &Invoke<Callable>;
+
+		if constexpr (!std::is_trivially_copyable_v<Callable>)
+			m_Manage = &Manage<Callable>;
+	}
+
+	// Binds a non-static member function to an instance without any intermediate wrapper.
+	template<typename T_Class, typename T_Member_Fn>
+	static EventDelegate bind(T_Class* instance, T_Member_Fn callback)
+	{
+		return EventDelegate([instance, callback](const T_Event_Type& event) { return (instance->*callback)(event); });
+	}
+
+	EventDelegate(const EventDelegate& other)
+	{
+		copyFrom(other);
+	}
+
+	EventDelegate(EventDelegate&& other) noexcept
+	{
+		moveFrom(other);
+	}
+
+	EventDelegate& operator=(const EventDelegate& other)
+	{
+		if (this != &other)
+		{
+			reset();
+			copyFrom(other);
+		}
+
+		return *this;
+	}
+
+	EventDelegate& operator=(EventDelegate&& other) noexcept
+	{
+		if (this != &other)
+		{
+			reset();
+			moveFrom(other);
+		}
+
+		return *this;
+	}
+
+	EventDelegate& operator=(std::nullptr_t)
+	{
+		reset();
+		return *this;
+	}
+
+	~EventDelegate()
+	{
+		reset();
+	}
+
+	void reset()
+	{
+		if (m_Manage)
+			m_Manage(StorageOp::Destroy, nullptr, m_Storage);
+
+		m_Invoke = nullptr;
+		m_Manage = nullptr;
+	}
+
+	// Returns true if the listener handled the event.
+	bool operator()(const T_Event_Type& event) const
+	{
+		return m_Invoke(m_Storage, event);
+	}
+
+	explicit operator bool() const { return m_Invoke != nullptr; };
+
+	bool operator==(std::nullptr_t) const { return m_Invoke == nullptr; };
+
+private:
+	void copyFrom(const EventDelegate& other)
+	{
+		if (other.m_Manage)
+			other.m_Manage(StorageOp::Copy, m_Storage, other.m_Storage);
+		else
+			std::memcpy(m_Storage, other.m_Storage, StorageSize);
+
+		m_Invoke = other.m_Invoke;
+		m_Manage = other.m_Manage;
+	}
+
+	void moveFrom(EventDelegate& other)
+	{
+		if (other.m_Manage)
+			other.m_Manage(StorageOp::Move, m_Storage, other.m_Storage);
+		else
+			std::memcpy(m_Storage, other.m_Storage, StorageSize);
+
+		m_Invoke = other.m_Invoke;
+		m_Manage = other.m_Manage;
+
+		other.m_Invoke = nullptr;
+		other.m_Manage = nullptr;
+	}
+
+private:
+	alignas(std::max_align_t) mutable std::byte m_Storage[StorageSize];
+	Invoke_Fn m_Invoke = nullptr;
+	Manage_Fn m_Manage = nullptr;
+};
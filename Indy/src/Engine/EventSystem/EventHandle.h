@@ -1,14 +1,42 @@
 #pragma once
 
+#include "EventStats.h"
+
+#include <cstddef>
+#include <cstdint>
+
 struct EventContainerBase;
 
+// Generational handle to a listener slot. A slot's generation is bumped whenever its listener is
+//	removed, so handles to a removed (and possibly reused) slot are detected as stale.
 struct EventHandle
 {
-	uint32_t event_id;
-	EventContainerBase* container;
+	uint32_t index = 0;
+	uint32_t generation = 0;
+	EventContainerBase* container = nullptr;
 };
 
 struct EventContainerBase 
 {
+	using Record_Fn = void(*)(uint32_t typeId, const void* event, size_t size);
+
+	// Dense registry id and size of the container's event type. Set when the container is created.
+	uint32_t type_id = UINT32_MAX;
+	uint32_t event_size = 0;
+
+	// Called with every event dispatched through this container while set. See EventRecorder.
+	Record_Fn record = nullptr;
+
+	#if ENGINE_EVENT_STATS
+		EventDispatchStats stats;
+	#endif
+
+	virtual ~EventContainerBase() = default;
+
+	virtual uint32_t getListenerCount() const { return 0; };
+
 	virtual bool removeCallback(const EventHandle& handle) { return false; };
+
+	// Dispatches an event from its raw bytes. Only supported for trivially copyable events.
+	virtual bool invokeRaw(const void* event) { return false; };
 };
\ No newline at end of file
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstdint>
+
+/* Binary layout of event recordings (see EventRecorder and EventReplayer).
+*	A log is a header followed by a packed sequence of records. Each record is a small fixed header
+*	and the raw bytes of one dispatched event, padded to 8 bytes. Event types are stored by their
+*	compile-time hash in the header's type table, so a log can be replayed by any build that
+*	declares the same event structs, regardless of the order in which types were registered.
+*/
+
+struct EventLogType
+{
+	uint64_t hash = 0;
+	uint32_t size = 0;
+	uint32_t reserved = 0;
+};
+
+struct EventLogHeader
+{
+	static constexpr uint32_t Magic = 0x4C564549; // "IEVL"
+	static constexpr uint32_t Version = 1;
+	static constexpr uint32_t MaxTypes = 64;
+
+	uint32_t magic = Magic;
+	uint32_t version = Version;
+	uint32_t type_count = 0;
+	uint32_t reserved = 0;
+
+	// Number of records, and the offset just past the last one.
+	uint64_t record_count = 0;
+	uint64_t end = 0;
+
+	EventLogType types[MaxTypes];
+};
+
+struct EventLogRecord
+{
+	static constexpr uint32_t Alignment = 8;
+
+	// Frame number, relative to the start of the recording.
+	uint32_t frame = 0;
+
+	// Index into the header's type table, and the size of the event that follows.
+	uint16_t type = 0;
+	uint16_t size = 0;
+
+	// Nanoseconds since the start of the recording.
+	uint64_t time = 0;
+};
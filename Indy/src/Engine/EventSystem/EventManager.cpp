@@ -0,0 +1,66 @@
+#include "EventManager.h"
+
+#include <algorithm>
+#include <vector>
+
+EventManager& EventManager::GetInstance()
+{
+	static EventManager instance;
+	return instance;
+}
+
+size_t EventManager::DispatchQueuedEvents()
+{
+	size_t count = 0;
+
+	for (uint32_t id = 0; id < EventRegistry::GetTypeCount(); id++)
+	{
+		EventQueueBase* queue = EventRegistry::GetType(id).queue.load(std::memory_order_acquire);
+
+		if (queue != nullptr)
+			count += queue->drain();
+	}
+
+	return count;
+}
+
+void EventManager::FlushEventStream()
+{
+	m_EventStream.flush();
+}
+
+void EventManager::ResetDispatchStats()
+{
+	#if ENGINE_EVENT_STATS
+		for (uint32_t id = 0; id < EventRegistry::GetTypeCount(); id++)
+			EventRegistry::GetType(id).container->stats.reset();
+	#endif
+}
+
+void EventManager::LogDispatchStats() const
+{
+	#if ENGINE_EVENT_STATS
+		std::vector<uint32_t> ids;
+
+		for (uint32_t id = 0; id < EventRegistry::GetTypeCount(); id++)
+		{
+			if (EventRegistry::GetType(id).container->stats.dispatch_count != 0)
+				ids.push_back(id);
+		}
+
+		std::sort(ids.begin(), ids.end(), [](uint32_t a, uint32_t b)
+			{ return EventRegistry::GetType(a).container->stats.total_time > EventRegistry::GetType(b).container->stats.total_time; });
+
+		INDY_CORE_INFO("Event dispatch stats ({0} types dispatched):", ids.size());
+
+		for (uint32_t id : ids)
+		{
+			const EventTypeInfo& type = EventRegistry::GetType(id);
+			const EventDispatchStats& stats = type.container->stats;
+
+			INDY_CORE_INFO("  {0}: {1} dispatches, {2} listeners, total {3:.3f}ms, avg {4:.2f}us, p99 {5:.2f}us, slowest listener {6:.2f}us (slot {7})",
+				type.name, stats.dispatch_count, type.container->getListenerCount(), stats.total_time / 1e6,
+				stats.getAverage() / 1e3, stats.getPercentile(0.99) / 1e3, stats.slowest_listener_time / 1e3, stats.slowest_listener_slot);
+		}
+	#endif
+}
\ No newline at end of file
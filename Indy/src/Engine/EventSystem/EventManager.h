@@ -1,13 +1,22 @@
 #pragma once
 
+#include "Engine/Core/Core.h"
 #include "EventContainer.h"
+#include "EventCoroutine.h"
 #include "EventHandle.h"
+#include "EventQueue.h"
+#include "EventRegistry.h"
+#include "EventStream.h"
+#include "EventTypeId.h"
 
-/* Todo: Make this thread-safe
-		Currently, all events are considered to be "blocking". They must
-		be delt with as soon as they are invoked and not later. A better alternative
-		would be to make a multi-threaded solution, or to use some sort
-		of queue that handles events at an appropriate time.
+#include <type_traits>
+#include <utility>
+
+/* Thread-safety:
+		DispatchEvent is synchronous and must only be called from the main thread; listeners
+		are invoked before it returns. Other threads must use QueueEvent instead, which pushes
+		the event into a lock-free queue. Queued events are dispatched on the main thread when
+		DispatchQueuedEvents is called (once per frame, by Application::Run).
 */
 
 /* This class is meant to be as flexible as possible when it comes to event creation and dispatching.
@@ -16,49 +25,202 @@
 *	you need the event to process, and attach methods to operate on that event.
 */
 
-class EventManager
+class ENGINE_API EventManager
 {
 
 private:
 
-	// Template container for storing event callbacks based on the event type.
+	// Container storing the event callbacks for an event type, owned by the EventRegistry.
+	//	The lookup is resolved once per type, per module.
 	template<typename T_Event_Type>
-	static inline EventContainer<T_Event_Type> sI_EventContainer;
+	static EventContainer<T_Event_Type>& GetContainer()
+	{
+		static EventContainer<T_Event_Type>& container =
+			static_cast<EventContainer<T_Event_Type>&>(*EventRegistry::GetType(EventRegistry::GetId<T_Event_Type>()).container);
 
-public:
+		return container;
+	}
 
-	// Managed Singleton Instance.
-	static EventManager& GetInstance()
+	// Deferred events waiting to be dispatched to the type's container. Created on first use.
+	template<typename T_Event_Type>
+	static EventQueue<T_Event_Type>& GetQueue()
 	{
-		static EventManager instance;
-		return instance;
+		static EventQueue<T_Event_Type>& queue = static_cast<EventQueue<T_Event_Type>&>(*EventRegistry::GetOrCreateQueue(
+			EventRegistry::GetId<T_Event_Type>(),
+			[](EventContainerBase* container) -> EventQueueBase* { return new EventQueue<T_Event_Type>(static_cast<EventContainer<T_Event_Type>&>(*container)); }
+		));
+
+		return queue;
 	}
 
+	// Flushes one type-sorted group of the frame event stream, coalescing it first.
+	template<typename T_Event_Type>
+	static void FlushStreamedEvents(std::byte* events, size_t count)
+	{
+		T_Event_Type* first = reinterpret_cast<T_Event_Type*>(events);
+		count = EventCoalescer<T_Event_Type>::fold(first, count, GetContainer<T_Event_Type>().coalesce_stats);
+
+		GetInstance().DispatchEventBatch<T_Event_Type>({ first, count });
+	}
+
+	EventStream m_EventStream;
+	bool m_StreamEnabled = false;
+
+public:
+
+	// Managed Singleton Instance. Defined in the engine module, so there is only one per process.
+	static EventManager& GetInstance();
+
 	// Event Registering for regular function pointers and "static" class function pointers
 	template<typename T_Event_Type, typename EventCallback_Fn>
-	EventHandle AddEventListener(const EventCallback_Fn& callback)
+	EventHandle AddEventListener(const EventCallback_Fn& callback, EventPriority priority = {})
 	{
-		return sI_EventContainer<T_Event_Type>.addCallback(callback);
+		return GetContainer<T_Event_Type>().addCallback(callback, priority);
 	}
 
 	// Overload for non-static class member function pointers
 	template<typename T_Event_Type, typename T_Class_Instance, typename EventCallback_Fn>
-	EventHandle AddEventListener(const T_Class_Instance& instance, const EventCallback_Fn& callback)
+	EventHandle AddEventListener(const T_Class_Instance& instance, const EventCallback_Fn& callback, EventPriority priority = {})
+	{
+		return GetContainer<T_Event_Type>().addCallback(EventDelegate<T_Event_Type>::bind(instance, callback), priority);
+	}
+
+	// Channel listeners only receive events whose getChannel() matches the given channel. See EventChannel.h.
+	template<typename T_Event_Type, typename EventCallback_Fn>
+	EventHandle AddChannelEventListener(EventChannel channel, const EventCallback_Fn& callback, EventPriority priority = {})
+	{
+		static_assert(HasEventChannel<T_Event_Type>(), "Event type has no channels. Define 'EventChannel getChannel() const'.");
+
+		return GetContainer<T_Event_Type>().getChannel(channel).addCallback(callback, priority);
+	}
+
+	template<typename T_Event_Type, typename T_Class_Instance, typename EventCallback_Fn>
+	EventHandle AddChannelEventListener(EventChannel channel, const T_Class_Instance& instance, const EventCallback_Fn& callback, EventPriority priority = {})
+	{
+		static_assert(HasEventChannel<T_Event_Type>(), "Event type has no channels. Define 'EventChannel getChannel() const'.");
+
+		return GetContainer<T_Event_Type>().getChannel(channel).addCallback(EventDelegate<T_Event_Type>::bind(instance, callback), priority);
+	}
+
+	// Awaitable that resumes the awaiting coroutine on the next dispatch of an event type. See EventCoroutine.h.
+	template<typename T_Event_Type>
+	EventAwaiter<T_Event_Type> WaitForEvent()
+	{
+		return EventAwaiter<T_Event_Type>(&GetContainer<T_Event_Type>().awaiters);
+	}
+
+	template<typename T_Event_Type>
+	EventAwaiter<T_Event_Type> WaitForEvent(EventChannel channel)
+	{
+		static_assert(HasEventChannel<T_Event_Type>(), "Event type has no channels. Define 'EventChannel getChannel() const'.");
+
+		return EventAwaiter<T_Event_Type>(&GetContainer<T_Event_Type>().awaiters, channel);
+	}
+
+	// Batch listeners receive every event of a type from the frame event stream in a single call.
+	template<typename T_Event_Type, typename EventCallback_Fn>
+	EventHandle AddBatchEventListener(const EventCallback_Fn& callback, EventPriority priority = {})
 	{
-		return sI_EventContainer<T_Event_Type>.addCallback([instance, callback](T_Event_Type event) { (instance->*callback)(event); });
+		return GetContainer<EventBatch<T_Event_Type>>().addCallback(callback, priority);
 	}
 
+	// Removes a listener and clears the handle. Returns false for empty or stale handles.
 	bool RemoveEventListener(EventHandle& handle)
 	{
-		return handle.container->removeCallback(handle);
+		if (handle.container == nullptr || !handle.container->removeCallback(handle))
+			return false;
+
+		handle.container = nullptr;
+		return true;
+	}
+
+	// Returns true if a listener handled the event. Listeners receive the event by const reference,
+	//	so temporaries and const events can be dispatched without a copy.
+	template<typename T_Event_Type>
+	bool DispatchEvent(const T_Event_Type& event)
+	{
+		return GetContainer<T_Event_Type>().invokeCallbacks(event);
+	}
+
+	// Batch listeners get the whole span once, then regular listeners get each event in order.
+	//	A batch listener that handles the batch stops it from reaching the regular listeners.
+	template<typename T_Event_Type>
+	void DispatchEventBatch(std::span<const T_Event_Type> events)
+	{
+		if (events.empty())
+			return;
+
+		if (GetContainer<EventBatch<T_Event_Type>>().invokeCallbacks(EventBatch<T_Event_Type>{ events }))
+			return;
+
+		GetContainer<T_Event_Type>().invokeCallbacks(events);
+	}
+
+	// Appends an event to the frame event stream. It is dispatched, grouped with every other
+	//	event of its type, on the next FlushEventStream. Main thread only.
+	template<typename T_Event_Type>
+	void StreamEvent(const T_Event_Type& event)
+	{
+		static_assert(!IsEventPayloadBorrowed<T_Event_Type>(), "Events that borrow their payload can't be streamed.");
+
+		m_EventStream.append(event, EventRegistry::GetId<T_Event_Type>(), &FlushStreamedEvents<T_Event_Type>);
+	}
+
+	void FlushEventStream();
+
+	void SetEventStreamEnabled(bool enabled) { m_StreamEnabled = enabled; };
+	bool IsEventStreamEnabled() const { return m_StreamEnabled; };
+
+	// Safe to call from any thread. Returns false if the event's queue is full.
+	template<typename T_Event_Type>
+	bool QueueEvent(const T_Event_Type& event)
+	{
+		static_assert(!IsEventPayloadBorrowed<T_Event_Type>(), "Events that borrow their payload can't be queued.");
+
+		return GetQueue<T_Event_Type>().push(event);
+	}
+
+	// Rvalues are moved into the queue, so events owning heap data (strings, vectors) are never deep-copied.
+	template<typename T_Event_Type> requires (!std::is_reference_v<T_Event_Type>)
+	bool QueueEvent(T_Event_Type&& event)
+	{
+		static_assert(!IsEventPayloadBorrowed<T_Event_Type>(), "Events that borrow their payload can't be queued.");
+
+		return GetQueue<T_Event_Type>().push(std::move(event));
 	}
 
 	template<typename T_Event_Type>
-	void DispatchEvent(T_Event_Type& event)
+	const EventCoalesceStats& GetCoalesceStats() const
 	{
-		sI_EventContainer<T_Event_Type>.invokeCallbacks(event);
+		return GetContainer<T_Event_Type>().coalesce_stats;
 	}
 
+	// Dispatches all queued events, of every type. Main thread only.
+	size_t DispatchQueuedEvents();
+
+	// Dispatch timings for an event type (see EventStats.h). Always empty when ENGINE_EVENT_STATS is off.
+	template<typename T_Event_Type>
+	const EventDispatchStats& GetDispatchStats() const
+	{
+		#if ENGINE_EVENT_STATS
+			return GetContainer<T_Event_Type>().stats;
+		#else
+			static const EventDispatchStats s_Empty;
+			return s_Empty;
+		#endif
+	}
+
+	template<typename T_Event_Type>
+	uint32_t GetListenerCount() const
+	{
+		return GetContainer<T_Event_Type>().getListenerCount();
+	}
+
+	void ResetDispatchStats();
+
+	// Logs the dispatch stats of every event type that was dispatched, most expensive first.
+	void LogDispatchStats() const;
+
 private:
 	EventManager() {}; // Disable Constructor
 	EventManager(const EventManager& other) = delete; // Disable Copy Constructor
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstdint>
+
+/* Listener ordering.
+*	Listeners are invoked phase by phase (UI first, Debug last) and, within a phase, from the highest
+*	priority to the lowest. Listeners with equal phase and priority are invoked in reverse registration
+*	order. Any listener can stop an event from reaching the rest by returning true ("handled").
+*/
+
+enum class EventPhase : uint8_t
+{
+	UI,
+	Gameplay,
+	Debug
+};
+
+struct EventPriority
+{
+	EventPhase phase = EventPhase::Gameplay;
+	int16_t priority = 0;
+
+	// Independent listeners only read the event and touch no state shared with other listeners.
+	//	They may run concurrently on the job system (see Jobs.h), after the other listeners have run, and
+	//	can't stop propagation. They must not bind, unbind or dispatch events.
+	bool b_Independent = false;
+
+	// Dispatch order as a single sortable key. Lower keys are invoked first.
+	uint32_t getOrderKey() const
+	{
+		return ((uint32_t)phase << 16) | (uint32_t)(INT16_MAX - priority);
+	}
+};
@@ -0,0 +1,181 @@
+#pragma once
+
+#include "EventContainer.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+/* Bounded, lock-free multi-producer/single-consumer ring buffer used for deferred event dispatch.
+*	Any thread may push events into the queue. Only the main thread drains it, dispatching the
+*	queued events to the event's container (see Events::Enqueue and Events::DispatchQueued).
+*
+*	Each cell carries a sequence number that tells producers and the consumer whether the cell
+*	is free or filled for the current lap of the ring, so no locks are needed on either side.
+*/
+
+// Events may declare "static constexpr size_t QueueCapacity" to override the default queue size.
+template<typename T_Event_Type>
+constexpr size_t GetEventQueueCapacity()
+{
+	if constexpr (requires { T_Event_Type::QueueCapacity; })
+		return T_Event_Type::QueueCapacity;
+	else
+		return 1024;
+}
+
+struct EventQueueBase
+{
+	virtual ~EventQueueBase() = default;
+
+	virtual size_t drain() = 0;
+};
+
+template<typename T_Event_Type>
+class EventQueue : public EventQueueBase
+{
+	static constexpr size_t Capacity = GetEventQueueCapacity<T_Event_Type>();
+	static constexpr size_t CacheLineSize = 64;
+
+	static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Event queue capacity must be a power of two.");
+
+	struct Cell
+	{
+		std::atomic<size_t> sequence;
+		alignas(T_Event_Type) std::byte storage[sizeof(T_Event_Type)];
+	};
+
+public:
+	EventQueue(EventContainer<T_Event_Type>& container)
+		: m_Container(container)
+	{
+		for (size_t i = 0; i < Capacity; i++)
+			m_Cells[i].sequence.store(i, std::memory_order_relaxed);
+	}
+
+	~EventQueue() override
+	{
+		T_Event_Type* event;
+		while ((event = front()) != nullptr)
+			pop(event);
+	}
+
+	// Pushes an event from any thread. Returns false if the queue is full.
+	template<typename T_Event>
+	bool push(T_Event&& event)
+	{
+		size_t pos = m_EnqueuePos.load(std::memory_order_relaxed);
+		Cell* cell;
+
+		for (;;)
+		{
+			cell = &m_Cells[pos & (Capacity - 1)];
+			size_t sequence = cell->sequence.load(std::memory_order_acquire);
+			intptr_t diff = (intptr_t)sequence - (intptr_t)pos;
+
+			if (diff == 0)
+			{
+				if (m_EnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+					break;
+			}
+			else if (diff < 0)
+			{
+				return false;
+			}
+			else
+			{
+				pos = m_EnqueuePos.load(std::memory_order_relaxed);
+			}
+		}
+
+		::new (static_cast<void*>(cell->storage)) T_Event_Type(std::forward<T_Event>(event));
+		cell->sequence.store(pos + 1, std::memory_order_release);
+
+		return true;
+	}
+
+	// Dispatches every event that was queued before the call, coalescing them according to the
+	//	event's EventCoalescePolicy. Consumer (main) thread only. Events queued by listeners during
+	//	the drain are left for the next drain. Returns the number of raw events consumed.
+	size_t drain() override
+	{
+		size_t count = 0;
+		size_t end = m_EnqueuePos.load(std::memory_order_acquire);
+
+		T_Event_Type* event;
+
+		if constexpr (EventCoalescer<T_Event_Type>::Policy == EventCoalescePolicy::None)
+		{
+			while (m_DequeuePos != end && (event = front()) != nullptr)
+			{
+				m_Container.invokeCallbacks(*event);
+				pop(event);
+				count++;
+			}
+
+			m_Container.coalesce_stats.received += count;
+			m_Container.coalesce_stats.dispatched += count;
+		}
+		else
+		{
+			std::optional<T_Event_Type> pending;
+
+			while (m_DequeuePos != end && (event = front()) != nullptr)
+			{
+				count++;
+
+				if (!pending || !EventCoalescer<T_Event_Type>::fold(*pending, *event))
+				{
+					if (pending)
+						dispatch(*pending);
+
+					pending.emplace(std::move(*event));
+				}
+
+				pop(event);
+			}
+
+			if (pending)
+				dispatch(*pending);
+
+			m_Container.coalesce_stats.received += count;
+		}
+
+		return count;
+	}
+
+private:
+	void dispatch(const T_Event_Type& event)
+	{
+		m_Container.invokeCallbacks(event);
+		m_Container.coalesce_stats.dispatched++;
+	}
+
+	T_Event_Type* front()
+	{
+		Cell& cell = m_Cells[m_DequeuePos & (Capacity - 1)];
+
+		if (cell.sequence.load(std::memory_order_acquire) != m_DequeuePos + 1)
+			return nullptr;
+
+		return std::launder(reinterpret_cast<T_Event_Type*>(cell.storage));
+	}
+
+	void pop(T_Event_Type* event)
+	{
+		event->~T_Event_Type();
+		m_Cells[m_DequeuePos & (Capacity - 1)].sequence.store(m_DequeuePos + Capacity, std::memory_order_release);
+		m_DequeuePos++;
+	}
+
+private:
+	EventContainer<T_Event_Type>& m_Container;
+
+	alignas(CacheLineSize) std::atomic<size_t> m_EnqueuePos = 0;
+	alignas(CacheLineSize) size_t m_DequeuePos = 0;
+	alignas(CacheLineSize) Cell m_Cells[Capacity];
+};
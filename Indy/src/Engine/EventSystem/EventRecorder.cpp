@@ -0,0 +1,158 @@
+#include "EventRecorder.h"
+#include "EventLog.h"
+
+#include "Engine/Core/Log.h"
+#include "Engine/Core/MappedFile.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <new>
+
+namespace
+{
+	constexpr size_t InitialLogSize = 1 << 20;
+	constexpr uint16_t UnknownType = UINT16_MAX;
+
+	struct RecorderState
+	{
+		Engine::MappedFile file;
+		bool b_Recording = false;
+
+		uint32_t frame = 0;
+		std::chrono::steady_clock::time_point start;
+
+		// Registry id to index in the log's type table.
+		uint16_t log_types[EventRegistry::MaxEventTypes];
+	};
+
+	RecorderState s_Recorder;
+
+	EventLogHeader& GetHeader()
+	{
+		return *reinterpret_cast<EventLogHeader*>(s_Recorder.file.GetData());
+	}
+
+	// Adds a type to the log's type table on its first record.
+	uint16_t GetLogType(uint32_t typeId, size_t size)
+	{
+		uint16_t& logType = s_Recorder.log_types[typeId];
+		if (logType != UnknownType)
+			return logType;
+
+		EventLogHeader& header = GetHeader();
+		if (header.type_count == EventLogHeader::MaxTypes)
+		{
+			INDY_CORE_ERROR("Event log type limit ({0}) reached, '{1}' is not recorded.", EventLogHeader::MaxTypes, EventRegistry::GetType(typeId).name);
+			return UnknownType;
+		}
+
+		header.types[header.type_count] = EventLogType{ EventRegistry::GetType(typeId).hash, (uint32_t)size };
+		logType = (uint16_t)header.type_count++;
+
+		return logType;
+	}
+}
+
+bool EventRecorder::Start(const std::string& path)
+{
+	Stop();
+
+	if (!s_Recorder.file.Open(path, Engine::MappedFile::Access::ReadWrite, InitialLogSize))
+		return false;
+
+	EventLogHeader& header = *new (s_Recorder.file.GetData()) EventLogHeader();
+	header.end = sizeof(EventLogHeader);
+
+	std::fill(std::begin(s_Recorder.log_types), std::end(s_Recorder.log_types), UnknownType);
+
+	s_Recorder.frame = 0;
+	s_Recorder.start = std::chrono::steady_clock::now();
+	s_Recorder.b_Recording = true;
+
+	INDY_CORE_INFO("Recording events to '{0}'.", path);
+	return true;
+}
+
+void EventRecorder::Stop()
+{
+	if (!s_Recorder.b_Recording)
+		return;
+
+	s_Recorder.b_Recording = false;
+
+	uint64_t records = GetHeader().record_count;
+	uint64_t end = GetHeader().end;
+
+	s_Recorder.file.Resize((size_t)end);
+	s_Recorder.file.Close();
+
+	INDY_CORE_INFO("Recorded {0} events over {1} frames ({2} bytes).", records, s_Recorder.frame, end);
+}
+
+bool EventRecorder::IsRecording()
+{
+	return s_Recorder.b_Recording;
+}
+
+void EventRecorder::SetRecorded(uint32_t typeId, bool enabled)
+{
+	EventRegistry::GetType(typeId).container->record = enabled ? &Write : nullptr;
+}
+
+void EventRecorder::NextFrame()
+{
+	s_Recorder.frame++;
+}
+
+uint32_t EventRecorder::GetFrame()
+{
+	return s_Recorder.frame;
+}
+
+void EventRecorder::Write(uint32_t typeId, const void* event, size_t size)
+{
+	if (!s_Recorder.b_Recording)
+		return;
+
+	if (size > UINT16_MAX)
+	{
+		INDY_CORE_ERROR("'{0}' is too large to be recorded ({1} bytes).", EventRegistry::GetType(typeId).name, size);
+		return;
+	}
+
+	uint16_t logType = GetLogType(typeId, size);
+	if (logType == UnknownType)
+		return;
+
+	size_t paddedSize = (size + EventLogRecord::Alignment - 1) & ~(size_t)(EventLogRecord::Alignment - 1);
+	size_t recordSize = sizeof(EventLogRecord) + paddedSize;
+	size_t end = (size_t)GetHeader().end;
+
+	if (end + recordSize > s_Recorder.file.GetSize())
+	{
+		if (!s_Recorder.file.Resize(std::max(s_Recorder.file.GetSize() * 2, end + recordSize)))
+		{
+			INDY_CORE_ERROR("Event log could not grow, recording stopped.");
+			s_Recorder.b_Recording = false;
+			s_Recorder.file.Close();
+			return;
+		}
+	}
+
+	uint8_t* data = s_Recorder.file.GetData() + end;
+
+	EventLogRecord record;
+	record.frame = s_Recorder.frame;
+	record.type = logType;
+	record.size = (uint16_t)size;
+	record.time = (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - s_Recorder.start).count();
+
+	std::memcpy(data, &record, sizeof(EventLogRecord));
+	std::memcpy(data + sizeof(EventLogRecord), event, size);
+	std::memset(data + sizeof(EventLogRecord) + size, 0, paddedSize - size);
+
+	EventLogHeader& header = GetHeader();
+	header.end = end + recordSize;
+	header.record_count++;
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "Engine/Core/Core.h"
+#include "EventRegistry.h"
+
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+/* Records dispatched events into a memory-mapped log (see EventLog.h), stamped with the frame
+*	number and the time since recording started. Only selected types are recorded; every dispatch of
+*	those types is captured, whether it comes from Dispatch, the queue or the stream. Events are
+*	stored as raw bytes, so recorded types must be trivially copyable.
+*
+*	Recording happens on the main thread, like dispatch. The log grows as needed and is trimmed to
+*	its contents when recording stops.
+*/
+class ENGINE_API EventRecorder
+{
+public:
+	static bool Start(const std::string& path);
+	static void Stop();
+
+	static bool IsRecording();
+
+	// Selects an event type for recording. Types can be selected before or during a recording.
+	template<typename T_Event_Type>
+	static void Record(bool enabled = true)
+	{
+		static_assert(std::is_trivially_copyable_v<T_Event_Type>, "Recorded events must be trivially copyable.");
+		static_assert(!IsEventPayloadBorrowed<T_Event_Type>(), "Events that borrow their payload can't be recorded.");
+
+		SetRecorded(EventRegistry::GetId<T_Event_Type>(), enabled);
+	}
+
+	static void SetRecorded(uint32_t typeId, bool enabled);
+
+	// Advances the frame number stamped onto records. Called once per frame by Application::Run.
+	static void NextFrame();
+	static uint32_t GetFrame();
+
+private:
+	static void Write(uint32_t typeId, const void* event, size_t size);
+};
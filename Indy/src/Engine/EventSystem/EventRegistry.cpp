@@ -0,0 +1,123 @@
+#include "EventRegistry.h"
+#include "EventQueue.h"
+
+#include "Engine/Core/Log.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+
+namespace
+{
+	struct RegistryStorage
+	{
+		std::mutex mutex;
+		std::atomic<uint32_t> count = 0;
+		EventTypeInfo types[EventRegistry::MaxEventTypes];
+
+		~RegistryStorage()
+		{
+			for (uint32_t i = 0; i < count.load(); i++)
+			{
+				delete types[i].queue.load();
+				delete types[i].container;
+			}
+		}
+	};
+
+	RegistryStorage& GetStorage()
+	{
+		static RegistryStorage s_Storage;
+		return s_Storage;
+	}
+}
+
+uint32_t EventRegistry::Register(uint64_t hash, std::string_view name, uint32_t size, ContainerFactory_Fn createContainer)
+{
+	RegistryStorage& storage = GetStorage();
+	std::lock_guard<std::mutex> lock(storage.mutex);
+
+	uint32_t count = storage.count.load(std::memory_order_relaxed);
+	name = name.substr(0, sizeof(EventTypeInfo::name) - 1);
+
+	for (uint32_t id = 0; id < count; id++)
+	{
+		EventTypeInfo& type = storage.types[id];
+		if (type.hash != hash)
+			continue;
+
+		// The same type has the same name and size in every module. Types local to a translation unit
+		//	can only come from one module, so they must also share the container factory.
+		if (name != type.name || size != type.container->event_size || (IsLocalEventTypeName(name) && createContainer != type.create_container))
+		{
+			INDY_CORE_CRITICAL("Event types '{0}' ({1} bytes) and '{2}' ({3} bytes) have the same type hash. Rename one of them.",
+				name, size, type.name, type.container->event_size);
+			std::abort();
+		}
+
+		return id;
+	}
+
+	if (count == MaxEventTypes)
+	{
+		INDY_CORE_CRITICAL("Event type limit ({0}) reached while registering '{1}'.", MaxEventTypes, name);
+		std::abort();
+	}
+
+	EventTypeInfo& type = storage.types[count];
+	type.hash = hash;
+	type.container = createContainer();
+	type.container->type_id = count;
+	type.create_container = createContainer;
+
+	std::copy_n(name.data(), name.size(), type.name);
+	type.name[name.size()] = '\0';
+
+	storage.count.store(count + 1, std::memory_order_release);
+	return count;
+}
+
+EventQueueBase* EventRegistry::GetOrCreateQueue(uint32_t id, QueueFactory_Fn createQueue)
+{
+	EventTypeInfo& type = GetType(id);
+
+	EventQueueBase* queue = type.queue.load(std::memory_order_acquire);
+	if (queue != nullptr)
+		return queue;
+
+	std::lock_guard<std::mutex> lock(GetStorage().mutex);
+
+	queue = type.queue.load(std::memory_order_relaxed);
+	if (queue == nullptr)
+	{
+		queue = createQueue(type.container);
+		type.queue.store(queue, std::memory_order_release);
+	}
+
+	return queue;
+}
+
+uint32_t EventRegistry::FindId(uint64_t hash)
+{
+	RegistryStorage& storage = GetStorage();
+	uint32_t count = storage.count.load(std::memory_order_acquire);
+
+	for (uint32_t id = 0; id < count; id++)
+	{
+		if (storage.types[id].hash == hash)
+			return id;
+	}
+
+	return UINT32_MAX;
+}
+
+EventTypeInfo& EventRegistry::GetType(uint32_t id)
+{
+	return GetStorage().types[id];
+}
+
+uint32_t EventRegistry::GetTypeCount()
+{
+	return GetStorage().count.load(std::memory_order_acquire);
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "Engine/Core/Core.h"
+#include "EventContainer.h"
+#include "EventTypeId.h"
+
+#include <atomic>
+#include <cstdint>
+#include <string_view>
+
+struct EventQueueBase;
+
+/* Registry of every event type used by the application.
+*	Each event struct is assigned a dense id the first time it is used, keyed by its compile-time
+*	type hash. The registry lives in the engine module, so the same type gets the same id and the
+*	same container in the engine and in the client, regardless of how templates are instantiated
+*	across the DLL boundary. Containers (and, lazily, queues) are stored in a flat array indexed
+*	by id, which also allows iterating every event type.
+*
+*	Types are registered from the module that first uses them, through the factories below. Types
+*	are told apart by hash alone, so registering a different type under a known hash (two types with
+*	the same name in anonymous namespaces, or a hash collision) aborts, as does exceeding
+*	MaxEventTypes.
+*/
+
+struct EventTypeInfo
+{
+	uint64_t hash = 0;
+	char name[128] = {};
+
+	EventContainerBase* container = nullptr;
+	EventContainerBase* (*create_container)() = nullptr;
+	std::atomic<EventQueueBase*> queue = nullptr;
+};
+
+class ENGINE_API EventRegistry
+{
+public:
+	static constexpr uint32_t MaxEventTypes = 1024;
+
+	using ContainerFactory_Fn = EventContainerBase*(*)();
+	using QueueFactory_Fn = EventQueueBase*(*)(EventContainerBase* container);
+
+	// Returns the dense id for a type hash, registering the type (and creating its container) if it's new.
+	static uint32_t Register(uint64_t hash, std::string_view name, uint32_t size, ContainerFactory_Fn createContainer);
+
+	// Returns the type's queue, creating it on first use. Thread-safe.
+	static EventQueueBase* GetOrCreateQueue(uint32_t id, QueueFactory_Fn createQueue);
+
+	// Returns the dense id of an already registered type hash, or UINT32_MAX.
+	static uint32_t FindId(uint64_t hash);
+
+	static EventTypeInfo& GetType(uint32_t id);
+	static uint32_t GetTypeCount();
+
+	// Dense id of an event type. Resolved once per type, per module.
+	template<typename T_Event_Type>
+	static uint32_t GetId()
+	{
+		static const uint32_t id = Register(GetEventTypeHash<T_Event_Type>(), GetEventTypeName<T_Event_Type>(),
+			(uint32_t)sizeof(T_Event_Type), &CreateContainer<T_Event_Type>);
+		return id;
+	}
+
+private:
+	template<typename T_Event_Type>
+	static EventContainerBase* CreateContainer()
+	{
+		return new EventContainer<T_Event_Type>();
+	}
+};
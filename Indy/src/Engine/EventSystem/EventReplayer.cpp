@@ -0,0 +1,211 @@
+#include "EventReplayer.h"
+#include "EventLog.h"
+#include "EventRegistry.h"
+
+#include "Engine/Core/Log.h"
+#include "Engine/Core/MappedFile.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+namespace
+{
+	struct ReplayerState
+	{
+		Engine::MappedFile file;
+		bool b_Replaying = false;
+
+		double speed = 1.0;
+
+		// Replay clock, in recorded nanoseconds. Advanced by the real time between updates, times the speed.
+		double time = 0.0;
+		std::chrono::steady_clock::time_point last_update;
+
+		// FrameLocked replay: recorded frame dispatched by the next Update, counted up from the first recorded frame.
+		uint32_t frame = 0;
+
+		uint64_t offset = 0;
+		uint64_t end = 0;
+
+		// Log type index to registry id, or UINT32_MAX for types this run can't dispatch.
+		uint32_t type_ids[EventLogHeader::MaxTypes];
+
+		// Log type index to the recorded event size, which every record of the type must have.
+		uint32_t type_sizes[EventLogHeader::MaxTypes];
+		uint32_t type_count = 0;
+
+		// Registry id to remap function, and the aligned copy of the event it rewrites.
+		EventReplayer::Remap_Fn remaps[EventRegistry::MaxEventTypes] = {};
+		std::vector<std::max_align_t> remap_buffer;
+	};
+
+	ReplayerState s_Replayer;
+
+	EventLogRecord ReadRecord(uint64_t offset)
+	{
+		EventLogRecord record;
+		std::memcpy(&record, s_Replayer.file.GetData() + offset, sizeof(EventLogRecord));
+
+		return record;
+	}
+}
+
+bool EventReplayer::Start(const std::string& path, double speed)
+{
+	Stop();
+
+	if (!s_Replayer.file.Open(path, Engine::MappedFile::Access::Read))
+		return false;
+
+	EventLogHeader header;
+	if (s_Replayer.file.GetSize() >= sizeof(EventLogHeader))
+		std::memcpy(&header, s_Replayer.file.GetData(), sizeof(EventLogHeader));
+
+	if (s_Replayer.file.GetSize() < sizeof(EventLogHeader) || header.magic != EventLogHeader::Magic || header.version != EventLogHeader::Version ||
+		header.type_count > EventLogHeader::MaxTypes || header.end > s_Replayer.file.GetSize())
+	{
+		INDY_CORE_ERROR("'{0}' is not a valid event log.", path);
+		s_Replayer.file.Close();
+		return false;
+	}
+
+	std::fill(std::begin(s_Replayer.type_ids), std::end(s_Replayer.type_ids), UINT32_MAX);
+
+	for (uint32_t i = 0; i < header.type_count; i++)
+	{
+		uint32_t id = EventRegistry::FindId(header.types[i].hash);
+
+		if (id != UINT32_MAX && EventRegistry::GetType(id).container->event_size != header.types[i].size)
+		{
+			INDY_CORE_WARN("'{0}' changed size since it was recorded, its events are skipped.", EventRegistry::GetType(id).name);
+			id = UINT32_MAX;
+		}
+
+		s_Replayer.type_ids[i] = id;
+		s_Replayer.type_sizes[i] = header.types[i].size;
+	}
+
+	s_Replayer.type_count = header.type_count;
+	s_Replayer.speed = speed;
+	s_Replayer.time = 0.0;
+	s_Replayer.last_update = std::chrono::steady_clock::now();
+	s_Replayer.offset = sizeof(EventLogHeader);
+	s_Replayer.end = header.end;
+	s_Replayer.frame = s_Replayer.offset < s_Replayer.end ? ReadRecord(s_Replayer.offset).frame : 0;
+	s_Replayer.b_Replaying = true;
+
+	INDY_CORE_INFO("Replaying {0} events from '{1}'.", header.record_count, path);
+	return true;
+}
+
+void EventReplayer::Stop()
+{
+	if (!s_Replayer.b_Replaying)
+		return;
+
+	s_Replayer.b_Replaying = false;
+	s_Replayer.file.Close();
+}
+
+bool EventReplayer::IsReplaying()
+{
+	return s_Replayer.b_Replaying;
+}
+
+void EventReplayer::Update()
+{
+	if (!s_Replayer.b_Replaying)
+		return;
+
+	auto now = std::chrono::steady_clock::now();
+	double elapsed = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(now - s_Replayer.last_update).count();
+	s_Replayer.last_update = now;
+
+	bool b_FrameLocked = s_Replayer.speed <= FrameLocked;
+	uint32_t frame = s_Replayer.frame;
+
+	if (b_FrameLocked)
+	{
+		// One recorded frame per update, including frames without records, so gaps between events are kept.
+		s_Replayer.frame++;
+
+		if (s_Replayer.offset < s_Replayer.end)
+			s_Replayer.time = (double)ReadRecord(s_Replayer.offset).time;
+	}
+	else
+	{
+		s_Replayer.time += elapsed * s_Replayer.speed;
+	}
+
+	// Listeners may stop (or restart) the replay while it dispatches.
+	while (s_Replayer.b_Replaying && s_Replayer.offset < s_Replayer.end)
+	{
+		EventLogRecord record = ReadRecord(s_Replayer.offset);
+
+		if (b_FrameLocked ? record.frame > frame : (double)record.time > s_Replayer.time)
+			return;
+
+		// Keeps the frame count in step, in case the replay is switched to FrameLocked.
+		if (!b_FrameLocked)
+			s_Replayer.frame = record.frame + 1;
+
+		uint64_t payload = s_Replayer.offset + sizeof(EventLogRecord);
+		if (payload + record.size > s_Replayer.end)
+		{
+			INDY_CORE_ERROR("Event log is truncated, replay stopped.");
+			Stop();
+			return;
+		}
+
+		// Events are read as their registered type, which would run past a record of any other size.
+		if (record.type >= s_Replayer.type_count || record.size != s_Replayer.type_sizes[record.type])
+		{
+			INDY_CORE_ERROR("Event log is corrupt (record at offset {0}), replay stopped.", s_Replayer.offset);
+			Stop();
+			return;
+		}
+
+		s_Replayer.offset = payload + ((record.size + EventLogRecord::Alignment - 1) & ~(uint64_t)(EventLogRecord::Alignment - 1));
+
+		uint32_t id = s_Replayer.type_ids[record.type];
+		if (id == UINT32_MAX)
+			continue;
+
+		const void* event = s_Replayer.file.GetData() + payload;
+
+		if (EventReplayer::Remap_Fn remap = s_Replayer.remaps[id])
+		{
+			s_Replayer.remap_buffer.resize((record.size + sizeof(std::max_align_t) - 1) / sizeof(std::max_align_t));
+			std::memcpy(s_Replayer.remap_buffer.data(), event, record.size);
+
+			remap(s_Replayer.remap_buffer.data());
+			event = s_Replayer.remap_buffer.data();
+		}
+
+		EventRegistry::GetType(id).container->invokeRaw(event);
+	}
+
+	if (s_Replayer.b_Replaying && s_Replayer.offset >= s_Replayer.end)
+	{
+		INDY_CORE_INFO("Event replay finished.");
+		Stop();
+	}
+}
+
+void EventReplayer::SetSpeed(double speed)
+{
+	s_Replayer.speed = speed;
+}
+
+double EventReplayer::GetSpeed()
+{
+	return s_Replayer.speed;
+}
+
+void EventReplayer::SetRemap(uint32_t typeId, Remap_Fn remap)
+{
+	s_Replayer.remaps[typeId] = remap;
+}
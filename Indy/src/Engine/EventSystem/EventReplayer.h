@@ -0,0 +1,47 @@
+#pragma once
+
+#include "Engine/Core/Core.h"
+#include "EventRegistry.h"
+
+#include <cstdint>
+#include <string>
+
+/* Replays a log written by the EventRecorder through the EventManager.
+*	Each recorded event is dispatched to the current listeners of its type once it is due. With a
+*	positive speed, events are due when their timestamp (scaled by 1 / speed) has elapsed since
+*	replay started, so 1.0 reproduces the original timing and 4.0 replays four times faster. With
+*	FrameLocked, each Update dispatches exactly one recorded frame, including frames that recorded
+*	no events, which keeps the frame-by-frame sequence intact regardless of how fast frames run.
+*
+*	Recorded types that are never used by the current run are skipped. Events that refer to objects
+*	of the recording session (e.g. a window handle, which also keys their channel) can be rewritten
+*	before they are dispatched, see SetRemap. Main thread only.
+*/
+class ENGINE_API EventReplayer
+{
+public:
+	static constexpr double FrameLocked = 0.0;
+
+	static bool Start(const std::string& path, double speed = 1.0);
+	static void Stop();
+
+	static bool IsReplaying();
+
+	// Dispatches every event that is due. Called once per frame by Application::Run.
+	//	Replay stops by itself after the last record.
+	static void Update();
+
+	static void SetSpeed(double speed);
+	static double GetSpeed();
+
+	// Called with a copy of each replayed event of a type, which it may modify, before the event is dispatched.
+	using Remap_Fn = void(*)(void* event);
+
+	template<typename T_Event_Type>
+	static void SetRemap(Remap_Fn remap)
+	{
+		SetRemap(EventRegistry::GetId<T_Event_Type>(), remap);
+	}
+
+	static void SetRemap(uint32_t typeId, Remap_Fn remap);
+};
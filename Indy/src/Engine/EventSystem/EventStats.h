@@ -0,0 +1,137 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+
+/* Dispatch instrumentation.
+*	While ENGINE_EVENT_STATS is non-zero, every event container times its dispatches and each listener
+*	it invokes. Timing costs far more than the dispatch itself, so it is only on by default in Debug;
+*	define ENGINE_EVENT_STATS=1 to record in Release, or ENGINE_EVENT_STATS=0 to leave it out of Debug.
+*	Dist builds never record. The setting changes the layout of event containers, so the engine and
+*	client must agree on it.
+*
+*	Dispatch times are inclusive: a nested dispatch is also counted in the dispatch that caused it.
+*	Listeners bound to a channel are recorded in the stats of their event type's container.
+*	Independent listeners that run on the job system count towards the dispatch time, but aren't
+*	timed individually.
+*/
+
+#ifndef ENGINE_EVENT_STATS
+	#ifdef ENGINE_DEBUG
+		#define ENGINE_EVENT_STATS 1
+	#else
+		#define ENGINE_EVENT_STATS 0
+	#endif
+#endif
+
+#ifdef ENGINE_DIST
+	#undef ENGINE_EVENT_STATS
+	#define ENGINE_EVENT_STATS 0
+#endif
+
+struct EventContainerBase;
+
+using EventStatsClock = std::chrono::steady_clock;
+
+struct EventDispatchStats
+{
+	// Log-linear histogram of dispatch times in nanoseconds: exact below 16ns, then four buckets per
+	//	power of two (at most ~19% error per bucket), up to ~1100s.
+	static constexpr uint32_t LinearBuckets = 16;
+	static constexpr uint32_t SubBuckets = 4;
+	static constexpr uint32_t MaxExponent = 40;
+	static constexpr uint32_t BucketCount = LinearBuckets + (MaxExponent - 4) * SubBuckets;
+
+	uint64_t dispatch_count = 0;
+	uint64_t total_time = 0;
+	uint64_t max_time = 0;
+
+	// Slot, generation and container of the slowest single listener invocation, so it can be compared
+	//	with an EventHandle. The container differs from the stats' own for listeners bound to a channel.
+	uint64_t slowest_listener_time = 0;
+	uint32_t slowest_listener_slot = UINT32_MAX;
+	uint32_t slowest_listener_generation = 0;
+	const EventContainerBase* slowest_listener_container = nullptr;
+
+	uint32_t histogram[BucketCount] = {};
+
+	static uint32_t getBucket(uint64_t time)
+	{
+		if (time < LinearBuckets)
+			return (uint32_t)time;
+
+		uint32_t exponent = 63 - (uint32_t)std::countl_zero(time);
+		if (exponent >= MaxExponent)
+			return BucketCount - 1;
+
+		uint32_t mantissa = (uint32_t)(time >> (exponent - 2)) & (SubBuckets - 1);
+		return LinearBuckets + (exponent - 4) * SubBuckets + mantissa;
+	}
+
+	// Largest time that falls in a bucket.
+	static uint64_t getBucketLimit(uint32_t bucket)
+	{
+		if (bucket < LinearBuckets)
+			return bucket;
+
+		uint32_t exponent = 4 + (bucket - LinearBuckets) / SubBuckets;
+		uint64_t mantissa = (bucket - LinearBuckets) % SubBuckets;
+
+		return ((SubBuckets + mantissa + 1) << (exponent - 2)) - 1;
+	}
+
+	void recordDispatch(uint64_t time)
+	{
+		dispatch_count++;
+		total_time += time;
+
+		if (time > max_time)
+			max_time = time;
+
+		histogram[getBucket(time)]++;
+	}
+
+	void recordListener(uint64_t time, uint32_t slot, uint32_t generation, const EventContainerBase* container)
+	{
+		if (time <= slowest_listener_time)
+			return;
+
+		slowest_listener_time = time;
+		slowest_listener_slot = slot;
+		slowest_listener_generation = generation;
+		slowest_listener_container = container;
+	}
+
+	// Upper bound of the given percentile (0 to 1) of dispatch times, in nanoseconds.
+	uint64_t getPercentile(double percentile) const
+	{
+		if (dispatch_count == 0)
+			return 0;
+
+		uint64_t target = (uint64_t)(percentile * (double)dispatch_count);
+		if (target == 0)
+			target = 1;
+
+		uint64_t count = 0;
+		for (uint32_t bucket = 0; bucket < BucketCount; bucket++)
+		{
+			count += histogram[bucket];
+
+			if (count >= target)
+				return bucket + 1 == BucketCount ? max_time : std::min(getBucketLimit(bucket), max_time);
+		}
+
+		return max_time;
+	}
+
+	uint64_t getAverage() const { return dispatch_count != 0 ? total_time / dispatch_count : 0; };
+
+	void reset() { *this = EventDispatchStats(); };
+};
+
+inline uint64_t GetEventStatsElapsed(EventStatsClock::time_point start)
+{
+	return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(EventStatsClock::now() - start).count();
+}
@@ -0,0 +1,140 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+// Argument type for batch listeners. Converts implicitly, so listeners can simply take a std::span<const T>.
+template<typename T_Event_Type>
+struct EventBatch
+{
+	std::span<const T_Event_Type> events;
+
+	operator std::span<const T_Event_Type>() const { return events; };
+};
+
+/* Per-frame event stream.
+*	Events are appended, tagged with their dense type id (see EventRegistry), into a single linear byte buffer.
+*	On flush, the records are sorted by type (keeping submission order within a type) and copied
+*	type-by-type into a second buffer, so every type's events end up contiguous. Each group is then
+*	handed to its dispatcher as one span.
+*
+*	Buffers are reused between frames, so a stream only allocates while it grows to its peak size.
+*	Only trivially copyable events can be streamed. Main thread only.
+*/
+class EventStream
+{
+public:
+	// Receives a group's events packed contiguously. The group may be modified in place (e.g. coalesced).
+	using Flush_Fn = void(*)(std::byte* events, size_t count);
+
+private:
+	struct Record
+	{
+		uint32_t type_id;
+		uint32_t sequence;
+		uint32_t offset;
+		uint32_t size;
+		uint32_t alignment;
+		Flush_Fn flush;
+	};
+
+public:
+	template<typename T_Event_Type>
+	void append(const T_Event_Type& event, uint32_t typeId, Flush_Fn flush)
+	{
+		static_assert(std::is_trivially_copyable_v<T_Event_Type>, "Only trivially copyable events can be streamed.");
+		static_assert(alignof(T_Event_Type) <= alignof(std::max_align_t), "Streamed events can't be over-aligned.");
+
+		size_t offset = Align(m_Buffer.size(), alignof(T_Event_Type));
+		m_Buffer.resize(offset + sizeof(T_Event_Type));
+		std::memcpy(m_Buffer.data() + offset, &event, sizeof(T_Event_Type));
+
+		m_Records.push_back({
+			typeId,
+			(uint32_t)m_Records.size(),
+			(uint32_t)offset,
+			(uint32_t)sizeof(T_Event_Type),
+			(uint32_t)alignof(T_Event_Type),
+			flush
+		});
+	}
+
+	bool empty() const { return m_Records.empty(); };
+
+	// Groups the stream by type and flushes each group once. Events appended by listeners during
+	//	the flush are kept for the next flush, and a flush from a listener does nothing.
+	void flush()
+	{
+		if (m_Records.empty() || b_Flushing)
+			return;
+
+		b_Flushing = true;
+
+		// Swap out the stream being flushed so listeners can keep appending.
+		std::swap(m_Records, m_FlushRecords);
+		std::swap(m_Buffer, m_FlushBuffer);
+
+		std::sort(m_FlushRecords.begin(), m_FlushRecords.end(), [](const Record& a, const Record& b)
+		{
+			return a.type_id != b.type_id ? a.type_id < b.type_id : a.sequence < b.sequence;
+		});
+
+		// Pack each group contiguously, then flush the groups.
+		m_SortedBuffer.resize(m_FlushBuffer.size() + m_FlushRecords.size() * alignof(std::max_align_t));
+		m_Groups.clear();
+
+		size_t offset = 0;
+		for (size_t i = 0; i < m_FlushRecords.size(); )
+		{
+			const Record& first = m_FlushRecords[i];
+			offset = Align(offset, first.alignment);
+
+			Group group{ offset, 0, first.flush };
+
+			for (; i < m_FlushRecords.size() && m_FlushRecords[i].type_id == first.type_id; i++, group.count++)
+			{
+				std::memcpy(m_SortedBuffer.data() + offset, m_FlushBuffer.data() + m_FlushRecords[i].offset, first.size);
+				offset += first.size;
+			}
+
+			m_Groups.push_back(group);
+		}
+
+		for (const Group& group : m_Groups)
+			group.flush(m_SortedBuffer.data() + group.offset, group.count);
+
+		m_FlushRecords.clear();
+		m_FlushBuffer.clear();
+
+		b_Flushing = false;
+	}
+
+private:
+	static size_t Align(size_t offset, size_t alignment)
+	{
+		return (offset + alignment - 1) & ~(alignment - 1);
+	}
+
+	struct Group
+	{
+		size_t offset;
+		size_t count;
+		Flush_Fn flush;
+	};
+
+	std::vector<Record> m_Records;
+	std::vector<std::byte> m_Buffer;
+
+	std::vector<Record> m_FlushRecords;
+	std::vector<std::byte> m_FlushBuffer;
+	std::vector<std::byte> m_SortedBuffer; // Allocated by operator new, so aligned for any fundamental alignment.
+	std::vector<Group> m_Groups;
+
+	// The flush buffers and groups are in use until the flush returns.
+	bool b_Flushing = false;
+};
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+/* Compile-time identification of event types.
+*	The hash is an FNV-1a hash of the compiler's signature string for the type, so it is the same
+*	in every translation unit and every module that sees the same type, without RTTI. EventRegistry
+*	maps these hashes to dense runtime ids.
+*/
+
+template<typename T_Event_Type>
+constexpr std::string_view GetEventTypeSignature()
+{
+#if defined(_MSC_VER)
+	return __FUNCSIG__;
+#else
+	return __PRETTY_FUNCTION__;
+#endif
+}
+
+constexpr uint64_t HashEventTypeSignature(std::string_view signature)
+{
+	uint64_t hash = 14695981039346656037ull;
+
+	for (char c : signature)
+	{
+		hash ^= (uint64_t)(unsigned char)c;
+		hash *= 1099511628211ull;
+	}
+
+	return hash;
+}
+
+template<typename T_Event_Type>
+constexpr uint64_t GetEventTypeHash()
+{
+	return HashEventTypeSignature(GetEventTypeSignature<T_Event_Type>());
+}
+
+// Human-readable type name, extracted from the signature string (e.g. "Engine::MouseMoveEvent").
+template<typename T_Event_Type>
+constexpr std::string_view GetEventTypeName()
+{
+	std::string_view signature = GetEventTypeSignature<T_Event_Type>();
+
+#if defined(_MSC_VER)
+	constexpr std::string_view prefix = "GetEventTypeSignature<";
+	size_t begin = signature.find(prefix) + prefix.size();
+	size_t end = signature.rfind(">(void)");
+
+	std::string_view name = signature.substr(begin, end - begin);
+
+	if (name.starts_with("struct "))
+		name.remove_prefix(7);
+	else if (name.starts_with("class "))
+		name.remove_prefix(6);
+
+	return name;
+#else
+	constexpr std::string_view prefix = "T_Event_Type = ";
+	size_t begin = signature.find(prefix) + prefix.size();
+	size_t end = signature.find_first_of(";]", begin);
+
+	return signature.substr(begin, end - begin);
+#endif
+}
+
+// Whether a type name refers to a type in an anonymous namespace. Such types are local to their
+//	translation unit, so two of them can share a name (and therefore a hash) without being the same type.
+constexpr bool IsLocalEventTypeName(std::string_view name)
+{
+	return name.find("{anonymous}") != std::string_view::npos ||
+		name.find("(anonymous namespace)") != std::string_view::npos ||
+		name.find("`anonymous namespace'") != std::string_view::npos;
+}
+
+/* Borrowed payloads.
+*	Large payloads (e.g. the paths of a file drop) can be dispatched without copying them by having the
+*	event hold a view (a pointer or std::span) into memory owned by the dispatcher. Such events are only
+*	valid for the duration of the dispatch, so they opt out of deferred dispatch and recording with:
+*		static constexpr bool BorrowsPayload = true;
+*
+*	An event that views a copy of its payload in frame memory (see FrameAllocator::Copy) can be queued
+*	instead: the copy stays valid until the end of the next frame, by which time the queue is drained.
+*	Pointers aren't meaningful in a recording, so such events still shouldn't be recorded.
+*/
+template<typename T_Event_Type>
+constexpr bool IsEventPayloadBorrowed()
+{
+	if constexpr (requires { T_Event_Type::BorrowsPayload; })
+		return T_Event_Type::BorrowsPayload;
+	else
+		return false;
+}
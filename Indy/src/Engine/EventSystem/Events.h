@@ -10,16 +10,53 @@ namespace Events {
 
 	struct EventBase {};
 
+	// Listeners may return bool; returning true marks the event as handled and stops propagation.
+	//	The optional priority places the listener in the dispatch order (see EventPriority.h).
 	template<typename T_Event_Type, typename T_Callback_Function>
-	static inline EventHandle Bind(const T_Callback_Function& callback)
+	static inline EventHandle Bind(const T_Callback_Function& callback, EventPriority priority = {})
 	{
-		return EventManager::GetInstance().AddEventListener<T_Event_Type>(callback);
+		return EventManager::GetInstance().AddEventListener<T_Event_Type>(callback, priority);
 	}
 	
 	template<typename T_Event_Type, typename T_Class_Instance, typename T_Callback_Function>
-	static inline EventHandle Bind(const T_Class_Instance& instance, const T_Callback_Function& callback)
+	static inline EventHandle Bind(const T_Class_Instance& instance, const T_Callback_Function& callback, EventPriority priority = {})
 	{
-		return EventManager::GetInstance().AddEventListener<T_Event_Type>(instance, callback);
+		return EventManager::GetInstance().AddEventListener<T_Event_Type>(instance, callback, priority);
+	}
+
+	// Binds a listener to a single channel of an event type, e.g. the events of one window. See EventChannel.h.
+	template<typename T_Event_Type, typename T_Callback_Function>
+	static inline EventHandle BindChannel(EventChannel channel, const T_Callback_Function& callback, EventPriority priority = {})
+	{
+		return EventManager::GetInstance().AddChannelEventListener<T_Event_Type>(channel, callback, priority);
+	}
+
+	template<typename T_Event_Type, typename T_Class_Instance, typename T_Callback_Function>
+	static inline EventHandle BindChannel(EventChannel channel, const T_Class_Instance& instance, const T_Callback_Function& callback, EventPriority priority = {})
+	{
+		return EventManager::GetInstance().AddChannelEventListener<T_Event_Type>(channel, instance, callback, priority);
+	}
+
+	// Binds a listener taking std::span<const T_Event_Type>, called once per frame stream flush.
+	template<typename T_Event_Type, typename T_Callback_Function>
+	static inline EventHandle BindBatch(const T_Callback_Function& callback, EventPriority priority = {})
+	{
+		return EventManager::GetInstance().AddBatchEventListener<T_Event_Type>(callback, priority);
+	}
+
+	// Awaitable for the next event of a type, optionally on a single channel:
+	//		T_Event_Type event = co_await Events::Next<T_Event_Type>();
+	//	Only usable from coroutines returning EventTask. See EventCoroutine.h.
+	template<typename T_Event_Type>
+	EventAwaiter<T_Event_Type> Next()
+	{
+		return EventManager::GetInstance().WaitForEvent<T_Event_Type>();
+	}
+
+	template<typename T_Event_Type>
+	EventAwaiter<T_Event_Type> Next(EventChannel channel)
+	{
+		return EventManager::GetInstance().WaitForEvent<T_Event_Type>(channel);
 	}
 
 	static inline bool UnBind(EventHandle& handle)
@@ -27,9 +64,80 @@ namespace Events {
 		return EventManager::GetInstance().RemoveEventListener(handle);
 	}
 
+	// Returns true if a listener handled the event. Accepts temporaries and const events.
+	template<typename T_Event_Type>
+	bool Dispatch(const T_Event_Type& event)
+	{
+		return EventManager::GetInstance().DispatchEvent<T_Event_Type>(event);
+	}
+
+	// Appends an event to the frame event stream. See EventStream.
+	template<typename T_Event_Type>
+	void Stream(const T_Event_Type& event)
+	{
+		EventManager::GetInstance().StreamEvent<T_Event_Type>(event);
+	}
+
+	// Dispatches everything in the frame event stream, one batch per event type. Does nothing when
+	//	called from a listener during a flush; events streamed meanwhile go out with the next flush.
+	static inline void FlushStream()
+	{
+		EventManager::GetInstance().FlushEventStream();
+	}
+
+	// When enabled, platform windows stream input and window events instead of dispatching them
+	//	one by one, and flush the stream after polling.
+	static inline void SetStreamEnabled(bool enabled)
+	{
+		EventManager::GetInstance().SetEventStreamEnabled(enabled);
+	}
+
+	static inline bool IsStreamEnabled()
+	{
+		return EventManager::GetInstance().IsEventStreamEnabled();
+	}
+
+	// Queues an event for dispatch on the main thread at the start of the next frame. Thread-safe.
 	template<typename T_Event_Type>
-	void Dispatch(T_Event_Type& event)
+	bool Enqueue(const T_Event_Type& event)
+	{
+		return EventManager::GetInstance().QueueEvent<T_Event_Type>(event);
+	}
+
+	template<typename T_Event_Type> requires (!std::is_reference_v<T_Event_Type>)
+	bool Enqueue(T_Event_Type&& event)
+	{
+		return EventManager::GetInstance().QueueEvent<T_Event_Type>(std::move(event));
+	}
+
+	// Dispatches every queued event. Called by the application once per frame.
+	static inline size_t DispatchQueued()
+	{
+		return EventManager::GetInstance().DispatchQueuedEvents();
+	}
+
+	// How many raw events of a type were received and dispatched by the queue and stream.
+	template<typename T_Event_Type>
+	const EventCoalesceStats& GetCoalesceStats()
+	{
+		return EventManager::GetInstance().GetCoalesceStats<T_Event_Type>();
+	}
+
+	// Dispatch timings for an event type. See EventStats.h.
+	template<typename T_Event_Type>
+	const EventDispatchStats& GetDispatchStats()
+	{
+		return EventManager::GetInstance().GetDispatchStats<T_Event_Type>();
+	}
+
+	template<typename T_Event_Type>
+	uint32_t GetListenerCount()
+	{
+		return EventManager::GetInstance().GetListenerCount<T_Event_Type>();
+	}
+
+	static inline void LogDispatchStats()
 	{
-		EventManager::GetInstance().DispatchEvent<T_Event_Type>(event);
+		EventManager::GetInstance().LogDispatchStats();
 	}
 }
\ No newline at end of file
@@ -0,0 +1,310 @@
+#include "Fiber.h"
+
+#include "Engine/Core/Log.h"
+
+#include <cstdlib>
+
+#ifdef ENGINE_PLATFORM_WINDOWS
+	#ifndef WIN32_LEAN_AND_MEAN
+		#define WIN32_LEAN_AND_MEAN
+	#endif
+	#ifndef NOMINMAX
+		#define NOMINMAX
+	#endif
+	#include <Windows.h>
+#else
+	// Linux on x86-64 switches fibers with a few lines of assembly. Elsewhere, or with
+	//	ENGINE_FIBER_UCONTEXT defined, ucontext is used, which costs a system call per switch
+	//	to save and restore the signal mask.
+	#if !defined(__x86_64__) || !defined(__linux__)
+		#define ENGINE_FIBER_UCONTEXT
+	#endif
+
+	#include <cstdint>
+	#include <sys/mman.h>
+	#include <unistd.h>
+
+	#ifdef ENGINE_FIBER_UCONTEXT
+		#include <ucontext.h>
+	#endif
+#endif
+
+namespace Engine
+{
+	void Fiber::Start(Fiber* fiber)
+	{
+		fiber->m_Entry(fiber->m_Context);
+
+		INDY_CORE_CRITICAL("A fiber's entry function returned.");
+		std::abort();
+	}
+
+#ifdef ENGINE_PLATFORM_WINDOWS
+
+	Fiber::Fiber(Entry_Fn entry, void* context, size_t stackSize)
+		: m_Entry(entry), m_Context(context)
+	{
+		// The stack is reserved, not committed: pages are committed as it grows, behind the guard page
+		//	Windows keeps below every thread and fiber stack.
+		m_Handle = CreateFiberEx(0, stackSize, 0, [](void* fiber) { Start(static_cast<Fiber*>(fiber)); }, this);
+
+		if (m_Handle == nullptr)
+			INDY_CORE_CRITICAL("Could not create fiber (error {0}).", GetLastError());
+	}
+
+	Fiber::~Fiber()
+	{
+		if (!b_Thread && m_Handle != nullptr)
+			DeleteFiber(m_Handle);
+	}
+
+	Fiber* Fiber::ConvertThread()
+	{
+		Fiber* fiber = new Fiber();
+		fiber->b_Thread = true;
+		fiber->m_Handle = ConvertThreadToFiber(nullptr);
+
+		if (fiber->m_Handle == nullptr)
+			INDY_CORE_CRITICAL("Could not convert thread to fiber (error {0}).", GetLastError());
+
+		return fiber;
+	}
+
+	void Fiber::RevertThread(Fiber* fiber)
+	{
+		ConvertFiberToThread();
+		delete fiber;
+	}
+
+	void Fiber::Switch(Fiber& from, Fiber& to)
+	{
+		SwitchToFiber(to.m_Handle);
+	}
+
+#else
+
+	namespace
+	{
+		/* A fiber stack mapped straight from the system, so it isn't zero-filled up front and pages are
+		*	only backed once used. The lowest page is left inaccessible: stacks grow down, so an overflow
+		*	faults there instead of silently overwriting whatever lies below.
+		*/
+		class FiberStack
+		{
+		public:
+			FiberStack() = default;
+
+			explicit FiberStack(size_t size)
+			{
+				size_t page = (size_t)sysconf(_SC_PAGESIZE);
+				m_GuardSize = page;
+				m_Size = (size + page - 1) / page * page + m_GuardSize;
+
+				void* mapping = mmap(nullptr, m_Size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_STACK, -1, 0);
+				if (mapping == MAP_FAILED)
+				{
+					INDY_CORE_CRITICAL("Could not map a {0} byte fiber stack.", m_Size);
+					std::abort();
+				}
+
+				m_Mapping = static_cast<uint8_t*>(mapping);
+				mprotect(m_Mapping, m_GuardSize, PROT_NONE);
+			}
+
+			~FiberStack()
+			{
+				if (m_Mapping != nullptr)
+					munmap(m_Mapping, m_Size);
+			}
+
+			FiberStack(const FiberStack&) = delete;
+			FiberStack& operator=(const FiberStack&) = delete;
+
+			// Usable memory, above the guard page.
+			uint8_t* GetBase() const { return m_Mapping + m_GuardSize; };
+			uint8_t* GetTop() const { return m_Mapping + m_Size; };
+			size_t GetSize() const { return (size_t)(GetTop() - GetBase()); };
+
+		private:
+			uint8_t* m_Mapping = nullptr;
+			size_t m_Size = 0;
+			size_t m_GuardSize = 0;
+		};
+	}
+
+#endif
+
+#if !defined(ENGINE_PLATFORM_WINDOWS) && !defined(ENGINE_FIBER_UCONTEXT)
+
+	/* Saves the callee-saved registers and the SSE/x87 control words on the current stack, stores the
+	*	stack pointer into *from, then loads to and restores the same registers from there. A new
+	*	fiber's stack is prepared so the first switch to it "returns" into IndyFiberEntry, which calls
+	*	r13(r12), that is Fiber::Start(fiber).
+	*/
+	extern "C" void IndySwitchFiber(void** from, void* to);
+	extern "C" void IndyFiberEntry();
+
+	asm(R"(
+		.text
+		.globl IndySwitchFiber
+		.type IndySwitchFiber, @function
+	IndySwitchFiber:
+		pushq %rbp
+		pushq %rbx
+		pushq %r12
+		pushq %r13
+		pushq %r14
+		pushq %r15
+		subq $8, %rsp
+		stmxcsr (%rsp)
+		fnstcw 4(%rsp)
+		movq %rsp, (%rdi)
+		movq %rsi, %rsp
+		ldmxcsr (%rsp)
+		fldcw 4(%rsp)
+		addq $8, %rsp
+		popq %r15
+		popq %r14
+		popq %r13
+		popq %r12
+		popq %rbx
+		popq %rbp
+		ret
+		.size IndySwitchFiber, .-IndySwitchFiber
+
+		.globl IndyFiberEntry
+		.type IndyFiberEntry, @function
+	IndyFiberEntry:
+		movq %r12, %rdi
+		callq *%r13
+		ud2
+		.size IndyFiberEntry, .-IndyFiberEntry
+	)");
+
+	namespace
+	{
+		struct FiberContext
+		{
+			void* stack_pointer = nullptr;
+			FiberStack stack;
+
+			// Threads converted to fibers keep their own stack.
+			FiberContext() = default;
+			explicit FiberContext(size_t stackSize) : stack(stackSize) {};
+		};
+	}
+
+	Fiber::Fiber(Entry_Fn entry, void* context, size_t stackSize)
+		: m_Entry(entry), m_Context(context)
+	{
+		FiberContext* fiber = new FiberContext(stackSize);
+		m_Handle = fiber;
+
+		// Frame popped by the first switch, from the stack pointer up: control words, r15, r14, r13,
+		//	r12, rbx, rbp and the return address. The return leaves the stack 16-byte aligned, as
+		//	IndyFiberEntry's call expects.
+		uintptr_t top = (uintptr_t)fiber->stack.GetTop() & ~(uintptr_t)15;
+		uint64_t* frame = reinterpret_cast<uint64_t*>(top - 80);
+
+		void(*start)(Fiber*) = &Start;
+
+		frame[0] = 0x1F80 | ((uint64_t)0x037F << 32);
+		frame[1] = 0;
+		frame[2] = 0;
+		frame[3] = reinterpret_cast<uint64_t>(start);
+		frame[4] = reinterpret_cast<uint64_t>(this);
+		frame[5] = 0;
+		frame[6] = 0;
+		frame[7] = reinterpret_cast<uint64_t>(&IndyFiberEntry);
+
+		fiber->stack_pointer = frame;
+	}
+
+	Fiber::~Fiber()
+	{
+		delete static_cast<FiberContext*>(m_Handle);
+	}
+
+	Fiber* Fiber::ConvertThread()
+	{
+		// The thread's own stack is used; its stack pointer is saved by the first switch away from it.
+		Fiber* fiber = new Fiber();
+		fiber->b_Thread = true;
+		fiber->m_Handle = new FiberContext();
+
+		return fiber;
+	}
+
+	void Fiber::RevertThread(Fiber* fiber)
+	{
+		delete fiber;
+	}
+
+	void Fiber::Switch(Fiber& from, Fiber& to)
+	{
+		IndySwitchFiber(&static_cast<FiberContext*>(from.m_Handle)->stack_pointer, static_cast<FiberContext*>(to.m_Handle)->stack_pointer);
+	}
+
+#elif !defined(ENGINE_PLATFORM_WINDOWS)
+
+	namespace
+	{
+		struct FiberContext
+		{
+			ucontext_t context;
+			FiberStack stack;
+
+			// Threads converted to fibers keep their own stack.
+			FiberContext() = default;
+			explicit FiberContext(size_t stackSize) : stack(stackSize) {};
+		};
+	}
+
+	Fiber::Fiber(Entry_Fn entry, void* context, size_t stackSize)
+		: m_Entry(entry), m_Context(context)
+	{
+		FiberContext* fiber = new FiberContext(stackSize);
+		m_Handle = fiber;
+
+		getcontext(&fiber->context);
+		fiber->context.uc_stack.ss_sp = fiber->stack.GetBase();
+		fiber->context.uc_stack.ss_size = fiber->stack.GetSize();
+		fiber->context.uc_link = nullptr;
+
+		// makecontext only passes int arguments, so the pointer is split in two.
+		void(*start)(int, int) = [](int high, int low)
+		{
+			Start(reinterpret_cast<Fiber*>(((uintptr_t)(uint32_t)high << 32) | (uintptr_t)(uint32_t)low));
+		};
+
+		uintptr_t self = reinterpret_cast<uintptr_t>(this);
+		makecontext(&fiber->context, reinterpret_cast<void(*)()>(start), 2, (int)(uint32_t)(self >> 32), (int)(uint32_t)self);
+	}
+
+	Fiber::~Fiber()
+	{
+		delete static_cast<FiberContext*>(m_Handle);
+	}
+
+	Fiber* Fiber::ConvertThread()
+	{
+		// The thread's own stack is used; its context is filled in by the first switch away from it.
+		Fiber* fiber = new Fiber();
+		fiber->b_Thread = true;
+		fiber->m_Handle = new FiberContext();
+
+		return fiber;
+	}
+
+	void Fiber::RevertThread(Fiber* fiber)
+	{
+		delete fiber;
+	}
+
+	void Fiber::Switch(Fiber& from, Fiber& to)
+	{
+		swapcontext(&static_cast<FiberContext*>(from.m_Handle)->context, &static_cast<FiberContext*>(to.m_Handle)->context);
+	}
+
+#endif
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "Engine/Core/Core.h"
+
+#include <cstddef>
+
+namespace Engine
+{
+	// A user-mode thread of execution with its own stack, switched to explicitly. Used by the job
+	//	system's fiber mode (see Jobs.h). Windows fibers on Windows, a hand-written context switch on
+	//	x86-64 Linux, and ucontext elsewhere.
+	//	A fiber's entry function must never return; it switches away instead. Stacks are committed as
+	//	they're used, with a guard page below them, so an overflow faults instead of corrupting memory.
+	class ENGINE_API Fiber
+	{
+	public:
+		using Entry_Fn = void(*)(void* context);
+
+		static constexpr size_t DefaultStackSize = 128 * 1024;
+
+		Fiber(Entry_Fn entry, void* context, size_t stackSize = DefaultStackSize);
+		~Fiber();
+
+		Fiber(const Fiber&) = delete;
+		Fiber& operator=(const Fiber&) = delete;
+
+		// Turns the calling thread into a fiber, so it can switch to other fibers and be switched
+		//	back to. RevertThread must be called on the same thread before it exits.
+		static Fiber* ConvertThread();
+		static void RevertThread(Fiber* fiber);
+
+		// Saves the running fiber into from and resumes to. A fiber may be resumed on any thread.
+		static void Switch(Fiber& from, Fiber& to);
+
+	private:
+		Fiber() = default;
+
+		static void Start(Fiber* fiber);
+
+	private:
+		Entry_Fn m_Entry = nullptr;
+		void* m_Context = nullptr;
+
+		// A fiber handle on Windows, the saved context and stack elsewhere.
+		void* m_Handle = nullptr;
+		bool b_Thread = false;
+	};
+}
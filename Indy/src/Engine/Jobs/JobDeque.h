@@ -0,0 +1,102 @@
+#pragma once
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+namespace Engine
+{
+	/* Bounded Chase-Lev work-stealing deque of pointers, one per job thread.
+	*	The owning thread pushes and pops at the bottom, like a stack, so it runs its newest (and
+	*	cache-warm) jobs first. Any other thread may steal from the top, taking the oldest jobs,
+	*	which tend to be the largest pieces of work. Only the last remaining item is contended, and
+	*	that race is settled with a single compare-and-swap on the top index.
+	*
+	*	Memory orderings follow Lê et al., "Correct and Efficient Work-Stealing for Weak Memory
+	*	Models" (2013). The deque doesn't grow: Push fails when it's full.
+	*/
+	template<typename T, uint32_t T_Capacity>
+	class JobDeque
+	{
+		static_assert(std::has_single_bit(T_Capacity), "Job deque capacity must be a power of two.");
+
+		static constexpr int64_t Mask = T_Capacity - 1;
+		static constexpr size_t CacheLineSize = 64;
+
+	public:
+		// Owner only.
+		bool Push(T* item)
+		{
+			int64_t bottom = m_Bottom.load(std::memory_order_relaxed);
+			int64_t top = m_Top.load(std::memory_order_acquire);
+
+			if (bottom - top >= (int64_t)T_Capacity)
+				return false;
+
+			m_Items[bottom & Mask].store(item, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_release);
+			m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+
+			return true;
+		}
+
+		// Owner only.
+		T* Pop()
+		{
+			int64_t bottom = m_Bottom.load(std::memory_order_relaxed) - 1;
+			m_Bottom.store(bottom, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			int64_t top = m_Top.load(std::memory_order_relaxed);
+
+			if (top > bottom)
+			{
+				m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+				return nullptr;
+			}
+
+			T* item = m_Items[bottom & Mask].load(std::memory_order_relaxed);
+
+			if (top == bottom)
+			{
+				// The last item: whoever advances top first gets it.
+				if (!m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+					item = nullptr;
+
+				m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+			}
+
+			return item;
+		}
+
+		// Any thread. May return nullptr while items remain, if another thread got there first.
+		T* Steal()
+		{
+			int64_t top = m_Top.load(std::memory_order_acquire);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			int64_t bottom = m_Bottom.load(std::memory_order_acquire);
+
+			if (top >= bottom)
+				return nullptr;
+
+			T* item = m_Items[top & Mask].load(std::memory_order_relaxed);
+
+			if (!m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+				return nullptr;
+
+			return item;
+		}
+
+		// Approximate when other threads are pushing or popping.
+		bool IsEmpty() const
+		{
+			return m_Bottom.load(std::memory_order_relaxed) <= m_Top.load(std::memory_order_relaxed);
+		}
+
+	private:
+		// Top is written by thieves and bottom by the owner, so they live on separate cache lines.
+		alignas(CacheLineSize) std::atomic<int64_t> m_Top = 0;
+		alignas(CacheLineSize) std::atomic<int64_t> m_Bottom = 0;
+		alignas(CacheLineSize) std::atomic<T*> m_Items[T_Capacity] = {};
+	};
+}
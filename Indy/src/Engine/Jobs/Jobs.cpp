@@ -0,0 +1,612 @@
+#include "Jobs.h"
+#include "JobDeque.h"
+#include "Fiber.h"
+
+#include "Engine/Core/Log.h"
+
+#include <algorithm>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Engine
+{
+	namespace
+	{
+		// Each thread owns a ring of job slots and a deque of the same size. A slot is reused once the
+		//	ring wraps around, after the job in it has started.
+		constexpr uint32_t JobsPerThread = 4096;
+
+		// Failed attempts to find a job before an idle worker goes to sleep.
+		constexpr uint32_t IdleSpins = 64;
+
+		struct Job
+		{
+			Jobs::Job_Fn function = nullptr;
+			void* context = nullptr;
+			std::atomic<uint32_t>* counter = nullptr;
+			std::atomic<bool> b_Pending = false;
+		};
+
+		struct JobThread;
+
+		// A pooled fiber that runs one job after another.
+		struct JobFiber
+		{
+			std::unique_ptr<Fiber> fiber;
+
+			// The job to run next, and the thread it was handed to. A parked fiber may resume on
+			//	another thread, so it reads the thread from here rather than from thread-local storage.
+			Jobs::Job_Fn function = nullptr;
+			void* context = nullptr;
+			std::atomic<uint32_t>* counter = nullptr;
+			JobThread* thread = nullptr;
+
+			// Set while the fiber is parked.
+			std::atomic<uint32_t>* wait_counter = nullptr;
+
+			// Set while the fiber has yielded: the job slot it's waiting to reuse.
+			std::atomic<bool>* wait_slot = nullptr;
+		};
+
+		enum class FiberAction { Finished, Parked, Yielded };
+
+		struct alignas(64) JobThread
+		{
+			JobDeque<Job, JobsPerThread> deque;
+			Job jobs[JobsPerThread];
+			uint32_t next_job = 0;
+
+			// Xorshift state used to pick which thread to steal from first.
+			uint32_t random = 1;
+
+			// Fiber mode: the thread's own fiber, which picks jobs, and the job fiber it's running.
+			//	A job fiber switching back tells the scheduler why through the action.
+			Fiber* scheduler = nullptr;
+			JobFiber* current = nullptr;
+			FiberAction action = FiberAction::Finished;
+			std::vector<JobFiber*> free_fibers;
+
+			// Job fibers that yielded on this thread until a slot of its job ring is free. They wait on
+			//	this thread's jobs, so only this thread resumes them.
+			std::vector<JobFiber*> yielded_fibers;
+		};
+
+		struct JobsState
+		{
+			// Index 0 belongs to the thread that started the system.
+			std::unique_ptr<JobThread[]> threads;
+			uint32_t thread_count = 0;
+
+			std::vector<std::thread> workers;
+			std::atomic<bool> b_Stop = false;
+
+			// Workers sleep on the epoch, which is bumped whenever jobs are pushed while any of them sleeps.
+			std::atomic<uint32_t> sleeping = 0;
+			std::atomic<uint32_t> wake_epoch = 0;
+
+			Jobs::Mode mode = Jobs::Mode::Threads;
+
+			// Every fiber ever created, and the parked ones. Idle fibers are kept per thread.
+			std::mutex fiber_mutex;
+			std::vector<std::unique_ptr<JobFiber>> fibers;
+			std::vector<JobFiber*> parked_fibers;
+			std::atomic<uint32_t> parked_count = 0;
+		};
+
+		JobsState s_Jobs;
+
+		thread_local uint32_t t_ThreadIndex = Jobs::InvalidThreadIndex;
+
+		// In fiber mode, a job that runs other jobs inline can come back on another thread. The compiler
+		//	assumes a function stays on one thread and may reuse a thread-local's address across calls,
+		//	so code that runs jobs reads the index through a call it can't see into.
+		#if defined(_MSC_VER)
+			__declspec(noinline)
+		#else
+			__attribute__((noinline))
+		#endif
+		uint32_t CurrentThreadIndex()
+		{
+			return t_ThreadIndex;
+		}
+
+		void WakeWorkers(size_t jobCount)
+		{
+			// Pairs with the fence in WorkerMain: either the worker sees the new work before it sleeps,
+			//	or this sees it sleeping.
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+
+			if (s_Jobs.sleeping.load(std::memory_order_relaxed) == 0)
+				return;
+
+			s_Jobs.wake_epoch.fetch_add(1, std::memory_order_release);
+
+			if (jobCount == 1)
+				s_Jobs.wake_epoch.notify_one();
+			else
+				s_Jobs.wake_epoch.notify_all();
+		}
+
+		void FinishJob(std::atomic<uint32_t>* counter)
+		{
+			if (counter == nullptr)
+				return;
+
+			// A fiber parked on the counter can now resume, possibly on a sleeping worker.
+			if (counter->fetch_sub(1, std::memory_order_acq_rel) == 1 && s_Jobs.mode == Jobs::Mode::Fibers)
+				WakeWorkers(1);
+		}
+
+		void Execute(Job* job)
+		{
+			// The slot is released before the job runs: a job that spawns and waits for enough jobs
+			//	can wrap its thread's ring around onto its own slot.
+			Jobs::Job_Fn function = job->function;
+			void* context = job->context;
+			std::atomic<uint32_t>* counter = job->counter;
+			job->b_Pending.store(false, std::memory_order_release);
+
+			function(context);
+			FinishJob(counter);
+		}
+
+		Job* FindJob(uint32_t index)
+		{
+			JobThread& thread = s_Jobs.threads[index];
+
+			if (Job* job = thread.deque.Pop())
+				return job;
+
+			thread.random ^= thread.random << 13;
+			thread.random ^= thread.random >> 17;
+			thread.random ^= thread.random << 5;
+
+			for (uint32_t i = 0; i < s_Jobs.thread_count; i++)
+			{
+				uint32_t victim = (thread.random + i) % s_Jobs.thread_count;
+
+				if (victim == index)
+					continue;
+
+				if (Job* job = s_Jobs.threads[victim].deque.Steal())
+					return job;
+			}
+
+			return nullptr;
+		}
+
+		void FiberMain(void* context)
+		{
+			JobFiber& self = *static_cast<JobFiber*>(context);
+
+			for (;;)
+			{
+				self.function(self.context);
+				FinishJob(self.counter);
+
+				self.thread->action = FiberAction::Finished;
+				Fiber::Switch(*self.fiber, *self.thread->scheduler);
+			}
+		}
+
+		JobFiber* AcquireFiber(JobThread& thread)
+		{
+			if (!thread.free_fibers.empty())
+			{
+				JobFiber* fiber = thread.free_fibers.back();
+				thread.free_fibers.pop_back();
+				return fiber;
+			}
+
+			std::unique_ptr<JobFiber> fiber = std::make_unique<JobFiber>();
+			fiber->fiber = std::make_unique<Fiber>(&FiberMain, fiber.get());
+
+			std::lock_guard<std::mutex> lock(s_Jobs.fiber_mutex);
+			return s_Jobs.fibers.emplace_back(std::move(fiber)).get();
+		}
+
+		JobFiber* TakeReadyFiber()
+		{
+			if (s_Jobs.parked_count.load(std::memory_order_acquire) == 0)
+				return nullptr;
+
+			std::lock_guard<std::mutex> lock(s_Jobs.fiber_mutex);
+
+			for (size_t i = 0; i < s_Jobs.parked_fibers.size(); i++)
+			{
+				JobFiber* fiber = s_Jobs.parked_fibers[i];
+				if (fiber->wait_counter->load(std::memory_order_acquire) != 0)
+					continue;
+
+				s_Jobs.parked_fibers[i] = s_Jobs.parked_fibers.back();
+				s_Jobs.parked_fibers.pop_back();
+				s_Jobs.parked_count.fetch_sub(1, std::memory_order_relaxed);
+
+				fiber->wait_counter = nullptr;
+				return fiber;
+			}
+
+			return nullptr;
+		}
+
+		bool HasReadyFibers()
+		{
+			if (s_Jobs.parked_count.load(std::memory_order_acquire) == 0)
+				return false;
+
+			std::lock_guard<std::mutex> lock(s_Jobs.fiber_mutex);
+
+			for (JobFiber* fiber : s_Jobs.parked_fibers)
+			{
+				if (fiber->wait_counter->load(std::memory_order_acquire) == 0)
+					return true;
+			}
+
+			return false;
+		}
+
+		JobFiber* TakeYieldedFiber(JobThread& thread)
+		{
+			for (size_t i = 0; i < thread.yielded_fibers.size(); i++)
+			{
+				JobFiber* fiber = thread.yielded_fibers[i];
+				if (fiber->wait_slot->load(std::memory_order_acquire))
+					continue;
+
+				thread.yielded_fibers[i] = thread.yielded_fibers.back();
+				thread.yielded_fibers.pop_back();
+
+				fiber->wait_slot = nullptr;
+				return fiber;
+			}
+
+			return nullptr;
+		}
+
+		// Fiber mode: resumes a parked or yielded fiber that can continue, or starts the next job on a
+		//	pooled fiber, and runs it until it finishes, parks or yields.
+		bool RunFiber(uint32_t index)
+		{
+			JobThread& thread = s_Jobs.threads[index];
+			JobFiber* fiber = TakeReadyFiber();
+
+			if (fiber == nullptr)
+				fiber = TakeYieldedFiber(thread);
+
+			if (fiber == nullptr)
+			{
+				Job* job = FindJob(index);
+				if (job == nullptr)
+					return false;
+
+				fiber = AcquireFiber(thread);
+				fiber->function = job->function;
+				fiber->context = job->context;
+				fiber->counter = job->counter;
+				job->b_Pending.store(false, std::memory_order_release);
+			}
+
+			fiber->thread = &thread;
+			thread.current = fiber;
+
+			Fiber::Switch(*thread.scheduler, *fiber->fiber);
+
+			thread.current = nullptr;
+
+			// The fiber's stack is no longer in use, so it can be parked or reused now.
+			if (thread.action == FiberAction::Parked)
+			{
+				std::lock_guard<std::mutex> lock(s_Jobs.fiber_mutex);
+				s_Jobs.parked_fibers.push_back(fiber);
+				s_Jobs.parked_count.fetch_add(1, std::memory_order_release);
+			}
+			else if (thread.action == FiberAction::Yielded)
+			{
+				thread.yielded_fibers.push_back(fiber);
+			}
+			else
+			{
+				thread.free_fibers.push_back(fiber);
+			}
+
+			return true;
+		}
+
+		bool RunOne(uint32_t index)
+		{
+			// Job fibers never get here (see AllocateJob); in thread mode, jobs run inline on the caller's stack.
+			if (s_Jobs.mode == Jobs::Mode::Fibers && s_Jobs.threads[index].current == nullptr)
+				return RunFiber(index);
+
+			Job* job = FindJob(index);
+			if (job == nullptr)
+				return false;
+
+			Execute(job);
+			return true;
+		}
+
+		bool HasPendingJobs()
+		{
+			for (uint32_t i = 0; i < s_Jobs.thread_count; i++)
+			{
+				if (!s_Jobs.threads[i].deque.IsEmpty())
+					return true;
+			}
+
+			return HasReadyFibers();
+		}
+
+		// Claims the calling thread's next job slot. The ring may have wrapped around onto a job that
+		//	hasn't started yet, in which case this helps until it has. A job fiber yields to its thread
+		//	instead: running jobs inline would nest them on its small stack, and one that waits would park
+		//	the fiber and could resume it on another thread, with this thread's ring half-used.
+		Job* AllocateJob(uint32_t& index)
+		{
+			for (;;)
+			{
+				index = CurrentThreadIndex();
+
+				JobThread& thread = s_Jobs.threads[index];
+				Job* job = &thread.jobs[thread.next_job % JobsPerThread];
+
+				if (!job->b_Pending.load(std::memory_order_acquire))
+				{
+					thread.next_job++;
+					return job;
+				}
+
+				if (thread.current != nullptr)
+				{
+					JobFiber* fiber = thread.current;
+					fiber->wait_slot = &job->b_Pending;
+					thread.action = FiberAction::Yielded;
+
+					Fiber::Switch(*fiber->fiber, *thread.scheduler);
+				}
+				else if (!RunOne(index))
+					std::this_thread::yield();
+			}
+		}
+
+		void WorkerMain(uint32_t index)
+		{
+			t_ThreadIndex = index;
+
+			JobThread& thread = s_Jobs.threads[index];
+			if (s_Jobs.mode == Jobs::Mode::Fibers)
+				thread.scheduler = Fiber::ConvertThread();
+
+			// Yielded fibers are unfinished jobs that only this thread can resume, so they keep it running.
+			uint32_t idle = 0;
+			while (!s_Jobs.b_Stop.load(std::memory_order_acquire) || !thread.yielded_fibers.empty())
+			{
+				if (RunOne(index))
+				{
+					idle = 0;
+					continue;
+				}
+
+				if (++idle < IdleSpins || !thread.yielded_fibers.empty())
+				{
+					std::this_thread::yield();
+					continue;
+				}
+
+				s_Jobs.sleeping.fetch_add(1, std::memory_order_relaxed);
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+
+				uint32_t epoch = s_Jobs.wake_epoch.load(std::memory_order_acquire);
+				if (!HasPendingJobs() && !s_Jobs.b_Stop.load(std::memory_order_acquire))
+					s_Jobs.wake_epoch.wait(epoch, std::memory_order_acquire);
+
+				s_Jobs.sleeping.fetch_sub(1, std::memory_order_relaxed);
+				idle = 0;
+			}
+
+			if (thread.scheduler != nullptr)
+				Fiber::RevertThread(thread.scheduler);
+		}
+	}
+
+	void Jobs::Start(uint32_t workerCount, Mode mode)
+	{
+		if (IsRunning())
+			return;
+
+		if (workerCount == 0)
+		{
+			uint32_t hardwareThreads = std::thread::hardware_concurrency();
+			workerCount = hardwareThreads > 1 ? hardwareThreads - 1 : 1;
+		}
+
+		s_Jobs.thread_count = workerCount + 1;
+		s_Jobs.threads = std::make_unique<JobThread[]>(s_Jobs.thread_count);
+
+		for (uint32_t i = 0; i < s_Jobs.thread_count; i++)
+			s_Jobs.threads[i].random = 0x9E3779B9u * (i + 1);
+
+		s_Jobs.mode = mode;
+		s_Jobs.b_Stop.store(false, std::memory_order_relaxed);
+		t_ThreadIndex = 0;
+
+		if (mode == Mode::Fibers)
+			s_Jobs.threads[0].scheduler = Fiber::ConvertThread();
+
+		s_Jobs.workers.reserve(workerCount);
+		for (uint32_t i = 1; i <= workerCount; i++)
+			s_Jobs.workers.emplace_back(WorkerMain, i);
+
+		INDY_CORE_INFO("Job system started with {0} workers{1}.", workerCount, mode == Mode::Fibers ? " in fiber mode" : "");
+	}
+
+	void Jobs::Stop()
+	{
+		if (!IsRunning())
+			return;
+
+		while (RunOne(0)) {}
+
+		s_Jobs.b_Stop.store(true, std::memory_order_seq_cst);
+		s_Jobs.wake_epoch.fetch_add(1, std::memory_order_seq_cst);
+		s_Jobs.wake_epoch.notify_all();
+
+		for (std::thread& worker : s_Jobs.workers)
+			worker.join();
+
+		s_Jobs.workers.clear();
+
+		// Jobs that workers pushed after the first drain, and fibers still parked.
+		while (RunOne(0) || s_Jobs.parked_count.load(std::memory_order_acquire) != 0 || !s_Jobs.threads[0].yielded_fibers.empty()) {}
+
+		if (s_Jobs.threads[0].scheduler != nullptr)
+			Fiber::RevertThread(s_Jobs.threads[0].scheduler);
+
+		s_Jobs.fibers.clear();
+
+		t_ThreadIndex = InvalidThreadIndex;
+		s_Jobs.threads.reset();
+		s_Jobs.thread_count = 0;
+	}
+
+	bool Jobs::IsRunning()
+	{
+		return s_Jobs.thread_count != 0;
+	}
+
+	uint32_t Jobs::GetWorkerCount()
+	{
+		return (uint32_t)s_Jobs.workers.size();
+	}
+
+	Jobs::Mode Jobs::GetMode()
+	{
+		return s_Jobs.mode;
+	}
+
+	uint32_t Jobs::GetThreadIndex()
+	{
+		return t_ThreadIndex;
+	}
+
+	void Jobs::Run(Job_Fn function, void* context, JobCounter* counter)
+	{
+		JobDeclaration job{ function, context };
+		Run(&job, 1, counter);
+	}
+
+	void Jobs::Run(const JobDeclaration* jobs, size_t count, JobCounter* counter)
+	{
+		if (CurrentThreadIndex() == InvalidThreadIndex)
+		{
+			for (size_t i = 0; i < count; i++)
+				jobs[i].function(jobs[i].context);
+
+			return;
+		}
+
+		std::atomic<uint32_t>* value = counter != nullptr ? &counter->m_Value : nullptr;
+		if (value != nullptr)
+			value->fetch_add((uint32_t)count, std::memory_order_relaxed);
+
+		for (size_t i = 0; i < count; i++)
+		{
+			// Jobs that run inline (while allocating, or when the deque is full) may move a job fiber
+			//	to another thread, so the owning thread is only valid until the next one runs.
+			uint32_t index;
+			Job* job = AllocateJob(index);
+			job->function = jobs[i].function;
+			job->context = jobs[i].context;
+			job->counter = value;
+			job->b_Pending.store(true, std::memory_order_relaxed);
+
+			// A full deque means the pool is saturated anyway.
+			if (!s_Jobs.threads[index].deque.Push(job))
+				Execute(job);
+		}
+
+		WakeWorkers(count);
+	}
+
+	void Jobs::Wait(JobCounter& counter)
+	{
+		uint32_t index = CurrentThreadIndex();
+
+		if (counter.IsDone())
+			return;
+
+		if (s_Jobs.mode == Mode::Fibers && index != InvalidThreadIndex && s_Jobs.threads[index].current != nullptr)
+		{
+			// Park this job's fiber. The scheduler resumes it, on whichever thread, once the counter is done.
+			JobThread& thread = s_Jobs.threads[index];
+			JobFiber* fiber = thread.current;
+
+			fiber->wait_counter = &counter.m_Value;
+			thread.action = FiberAction::Parked;
+
+			Fiber::Switch(*fiber->fiber, *thread.scheduler);
+			return;
+		}
+
+		while (!counter.IsDone())
+		{
+			if (index == InvalidThreadIndex || !RunOne(index))
+				std::this_thread::yield();
+		}
+	}
+
+	void Jobs::ParallelFor(size_t count, size_t batchSize, Range_Fn function, void* context)
+	{
+		if (count == 0)
+			return;
+
+		uint32_t threadCount = t_ThreadIndex != InvalidThreadIndex ? s_Jobs.thread_count : 1;
+
+		// A few batches per thread, so threads that finish early can pick up the slack.
+		if (batchSize == 0)
+			batchSize = std::max<size_t>(1, count / ((size_t)threadCount * 4));
+
+		size_t batchCount = (count + batchSize - 1) / batchSize;
+		if (batchCount < 2 || threadCount < 2)
+		{
+			function(context, 0, count);
+			return;
+		}
+
+		// Rather than one job per batch, a job per helping thread claims batches until none are left.
+		struct ParallelForState
+		{
+			Range_Fn function;
+			void* context;
+			size_t count;
+			size_t batch_size;
+			std::atomic<size_t> next = 0;
+		};
+
+		ParallelForState state{ function, context, count, batchSize };
+
+		Job_Fn runBatches = [](void* context)
+		{
+			ParallelForState& state = *static_cast<ParallelForState*>(context);
+
+			for (;;)
+			{
+				size_t begin = state.next.fetch_add(state.batch_size, std::memory_order_relaxed);
+				if (begin >= state.count)
+					return;
+
+				state.function(state.context, begin, std::min(begin + state.batch_size, state.count));
+			}
+		};
+
+		JobCounter counter;
+		size_t helpers = std::min<size_t>(batchCount, threadCount) - 1;
+
+		for (size_t i = 0; i < helpers; i++)
+			Run(runBatches, &state, &counter);
+
+		runBatches(&state);
+		Wait(counter);
+	}
+}
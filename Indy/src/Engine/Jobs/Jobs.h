@@ -0,0 +1,112 @@
+#pragma once
+
+#include "Engine/Core/Core.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+namespace Engine
+{
+	// Counts the unfinished jobs of one or more Run calls. Jobs::Wait returns once it reaches zero.
+	class JobCounter
+	{
+	public:
+		JobCounter() = default;
+
+		JobCounter(const JobCounter&) = delete;
+		JobCounter& operator=(const JobCounter&) = delete;
+
+		bool IsDone() const { return m_Value.load(std::memory_order_acquire) == 0; };
+		uint32_t GetValue() const { return m_Value.load(std::memory_order_relaxed); };
+
+	private:
+		friend class Jobs;
+
+		std::atomic<uint32_t> m_Value = 0;
+	};
+
+	struct JobDeclaration
+	{
+		using Job_Fn = void(*)(void* context);
+
+		Job_Fn function;
+		void* context;
+	};
+
+	/* Work-stealing job system.
+	*	A fixed pool of worker threads, one per hardware thread minus the main thread, each with its
+	*	own deque of jobs (see JobDeque.h). Jobs run on the worker that pushed them unless an idle
+	*	worker steals them first. Idle workers sleep until new jobs arrive.
+	*
+	*	Run schedules jobs and attaches them to an optional counter, which tracks how many of them
+	*	are unfinished. Dependencies are expressed by waiting on counters: Wait doesn't block the
+	*	thread, it runs other pending jobs until the counter reaches zero, so a job may wait on the
+	*	jobs it spawned without starving the pool.
+	*
+	*	In fiber mode, every job runs on a fiber (see Fiber.h) taken from a pool. A job that waits on
+	*	an unfinished counter parks its fiber and the thread moves on to other jobs; once the counter
+	*	reaches zero, any thread may resume the fiber. Waiting then costs neither a thread nor stack
+	*	depth, so deeply nested dependent jobs don't pile up on a few threads. The main thread isn't
+	*	a job, so its Wait still runs jobs until the counter is done. Jobs must not hold locks or rely
+	*	on thread-local state across a Wait, as they may resume on another thread. Job fibers never run
+	*	other jobs inline: a job that schedules more jobs than its thread has room for yields its fiber
+	*	until a slot frees up.
+	*
+	*	Jobs can be scheduled from the thread that started the system (the main thread) and from jobs.
+	*	Any other thread, or any thread while the system isn't running, runs them inline.
+	*
+	*	The system is started and stopped by the Application.
+	*/
+	class ENGINE_API Jobs
+	{
+	public:
+		using Job_Fn = JobDeclaration::Job_Fn;
+		using Range_Fn = void(*)(void* context, size_t begin, size_t end);
+
+		static constexpr uint32_t InvalidThreadIndex = UINT32_MAX;
+
+		enum class Mode { Threads, Fibers };
+
+		// A worker count of 0 uses one worker per hardware thread, minus the caller.
+		static void Start(uint32_t workerCount = 0, Mode mode = Mode::Threads);
+
+		// Runs every job still pending, then joins the workers.
+		static void Stop();
+
+		static bool IsRunning();
+		static uint32_t GetWorkerCount();
+		static Mode GetMode();
+
+		// 0 for the main thread, 1 to GetWorkerCount() for workers, InvalidThreadIndex for any other thread.
+		static uint32_t GetThreadIndex();
+
+		static void Run(Job_Fn function, void* context, JobCounter* counter = nullptr);
+		static void Run(const JobDeclaration* jobs, size_t count, JobCounter* counter = nullptr);
+
+		// Runs other jobs until the counter reaches zero. In fiber mode, a job parks instead.
+		static void Wait(JobCounter& counter);
+
+		// Invokes function(context, begin, end) over [0, count) in batches of at most batchSize
+		//	indices, spread across the pool and the calling thread, and returns once all are done.
+		//	A batch size of 0 picks one from the count and the number of workers.
+		static void ParallelFor(size_t count, size_t batchSize, Range_Fn function, void* context);
+
+		// Invokes function(index) for every index in [0, count).
+		template<typename T_Function>
+		static void ParallelFor(size_t count, size_t batchSize, T_Function&& function)
+		{
+			using Function = std::remove_reference_t<T_Function>;
+
+			ParallelFor(count, batchSize, [](void* context, size_t begin, size_t end)
+			{
+				Function& function = *static_cast<Function*>(context);
+
+				for (size_t i = begin; i < end; i++)
+					function(i);
+			}, const_cast<void*>(static_cast<const void*>(std::addressof(function))));
+		}
+	};
+}
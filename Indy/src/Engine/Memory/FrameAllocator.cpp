@@ -0,0 +1,266 @@
+#include "FrameAllocator.h"
+
+#include "Engine/Core/Log.h"
+#include "Engine/Jobs/Jobs.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace Engine
+{
+	namespace
+	{
+		constexpr size_t CacheLineSize = 64;
+
+		struct Block
+		{
+			uint8_t* data;
+			size_t size;
+		};
+
+		// Aligned to a cache line, so threads bumping neighbouring arenas don't share one.
+		struct alignas(CacheLineSize) Arena
+		{
+			uint8_t* cursor = nullptr;
+			uint8_t* end = nullptr;
+
+			std::vector<Block> blocks;
+			size_t block_size = 0;
+
+			// Bytes handed out since the last reset, including alignment padding.
+			size_t used = 0;
+		};
+
+		struct FrameBuffer
+		{
+			// One per job system thread, then the shared arena for any other thread.
+			std::unique_ptr<Arena[]> arenas;
+			std::mutex shared_mutex;
+
+			std::atomic<uint32_t> leases = 0;
+		};
+
+		struct FrameAllocatorState
+		{
+			std::unique_ptr<FrameBuffer[]> buffers;
+			uint32_t buffer_count = 0;
+			uint32_t thread_count = 0;
+
+			std::atomic<uint32_t> current = 0;
+
+			size_t peak_usage = 0;
+			uint64_t deferred_resets = 0;
+
+			bool b_Initialized = false;
+		};
+
+		FrameAllocatorState s_Frames;
+
+		// The thread that initialized the allocator uses the main thread's arena, even while the job system is stopped.
+		thread_local bool t_IsMainThread = false;
+
+		void FreeBlocks(Arena& arena)
+		{
+			for (Block& block : arena.blocks)
+				::operator delete(block.data, std::align_val_t(CacheLineSize));
+
+			arena.blocks.clear();
+			arena.cursor = nullptr;
+			arena.end = nullptr;
+		}
+
+		void AddBlock(Arena& arena, size_t minimumSize)
+		{
+			// Each block is at least twice the last, so an arena needs few blocks to catch up with a larger frame.
+			size_t size = std::max(arena.block_size, minimumSize);
+			arena.block_size = size * 2;
+
+			uint8_t* data = static_cast<uint8_t*>(::operator new(size, std::align_val_t(CacheLineSize)));
+			arena.blocks.push_back({ data, size });
+
+			arena.cursor = data;
+			arena.end = data + size;
+		}
+
+		void* AllocateFrom(Arena& arena, size_t size, size_t alignment)
+		{
+			uintptr_t cursor = (uintptr_t)arena.cursor;
+			uintptr_t aligned = (cursor + alignment - 1) & ~(uintptr_t)(alignment - 1);
+
+			if (arena.cursor == nullptr || aligned + size > (uintptr_t)arena.end)
+			{
+				AddBlock(arena, size + alignment);
+
+				cursor = (uintptr_t)arena.cursor;
+				aligned = (cursor + alignment - 1) & ~(uintptr_t)(alignment - 1);
+			}
+
+			arena.cursor = (uint8_t*)(aligned + size);
+			arena.used += aligned + size - cursor;
+
+			return (void*)aligned;
+		}
+
+		// Returns the bytes used since the last reset.
+		size_t ResetArena(Arena& arena)
+		{
+			size_t used = arena.used;
+			arena.used = 0;
+
+			if (arena.blocks.size() > 1)
+			{
+				size_t total = 0;
+				for (Block& block : arena.blocks)
+					total += block.size;
+
+				FreeBlocks(arena);
+				arena.block_size = total;
+				AddBlock(arena, total);
+			}
+			else if (!arena.blocks.empty())
+				arena.cursor = arena.blocks[0].data;
+
+			return used;
+		}
+
+		class FrameMemoryResource : public std::pmr::memory_resource
+		{
+		private:
+			void* do_allocate(size_t bytes, size_t alignment) override { return FrameAllocator::Allocate(bytes, alignment); };
+			void do_deallocate(void* pointer, size_t bytes, size_t alignment) override {};
+			bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; };
+		};
+
+		FrameMemoryResource s_Resource;
+	}
+
+	void FrameAllocator::Init(uint32_t bufferCount, size_t arenaSize)
+	{
+		if (s_Frames.b_Initialized)
+			return;
+
+		// Workers that join the job system later, e.g. after a restart with more workers, use the shared arena.
+		s_Frames.thread_count = (Jobs::IsRunning() ? Jobs::GetWorkerCount() : 0) + 1;
+		s_Frames.buffer_count = std::max(bufferCount, 1u);
+		s_Frames.buffers = std::make_unique<FrameBuffer[]>(s_Frames.buffer_count);
+
+		for (uint32_t i = 0; i < s_Frames.buffer_count; i++)
+		{
+			s_Frames.buffers[i].arenas = std::make_unique<Arena[]>(s_Frames.thread_count + 1);
+
+			for (uint32_t j = 0; j <= s_Frames.thread_count; j++)
+				s_Frames.buffers[i].arenas[j].block_size = arenaSize;
+		}
+
+		s_Frames.current.store(0, std::memory_order_relaxed);
+		t_IsMainThread = true;
+
+		s_Frames.peak_usage = 0;
+		s_Frames.deferred_resets = 0;
+		s_Frames.b_Initialized = true;
+	}
+
+	void FrameAllocator::Shutdown()
+	{
+		if (!s_Frames.b_Initialized)
+			return;
+
+		INDY_CORE_INFO("Frame allocator: {0} KiB peak per frame, {1} resets deferred by leases.",
+			s_Frames.peak_usage / 1024, s_Frames.deferred_resets);
+
+		for (uint32_t i = 0; i < s_Frames.buffer_count; i++)
+		{
+			for (uint32_t j = 0; j <= s_Frames.thread_count; j++)
+				FreeBlocks(s_Frames.buffers[i].arenas[j]);
+		}
+
+		s_Frames.buffers.reset();
+		t_IsMainThread = false;
+		s_Frames.b_Initialized = false;
+	}
+
+	bool FrameAllocator::IsInitialized()
+	{
+		return s_Frames.b_Initialized;
+	}
+
+	void FrameAllocator::BeginFrame()
+	{
+		if (!s_Frames.b_Initialized)
+			return;
+
+		uint32_t next = (s_Frames.current.load(std::memory_order_relaxed) + 1) % s_Frames.buffer_count;
+		FrameBuffer& buffer = s_Frames.buffers[next];
+
+		// Acquire pairs with Release, so everything the lease holders read is done before the memory is reused.
+		if (buffer.leases.load(std::memory_order_acquire) == 0)
+		{
+			size_t usage = 0;
+			for (uint32_t i = 0; i <= s_Frames.thread_count; i++)
+				usage += ResetArena(buffer.arenas[i]);
+
+			s_Frames.peak_usage = std::max(s_Frames.peak_usage, usage);
+		}
+		else
+			s_Frames.deferred_resets++;
+
+		s_Frames.current.store(next, std::memory_order_release);
+	}
+
+	void* FrameAllocator::Allocate(size_t size, size_t alignment)
+	{
+		if (!s_Frames.b_Initialized)
+		{
+			if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+				return ::operator new(size, std::align_val_t(alignment));
+
+			return ::operator new(size);
+		}
+
+		FrameBuffer& buffer = s_Frames.buffers[s_Frames.current.load(std::memory_order_acquire)];
+
+		uint32_t index = t_IsMainThread ? 0 : Jobs::GetThreadIndex();
+		if (index < s_Frames.thread_count)
+			return AllocateFrom(buffer.arenas[index], size, alignment);
+
+		std::lock_guard<std::mutex> lock(buffer.shared_mutex);
+		return AllocateFrom(buffer.arenas[s_Frames.thread_count], size, alignment);
+	}
+
+	std::string_view FrameAllocator::Copy(std::string_view source)
+	{
+		char* data = static_cast<char*>(Allocate(source.size() + 1, 1));
+		std::memcpy(data, source.data(), source.size());
+		data[source.size()] = '\0';
+
+		return { data, source.size() };
+	}
+
+	uint32_t FrameAllocator::Retain()
+	{
+		if (!s_Frames.b_Initialized)
+			return NoLease;
+
+		uint32_t current = s_Frames.current.load(std::memory_order_relaxed);
+		s_Frames.buffers[current].leases.fetch_add(1, std::memory_order_relaxed);
+
+		return current;
+	}
+
+	void FrameAllocator::Release(uint32_t lease)
+	{
+		if (lease == NoLease || !s_Frames.b_Initialized)
+			return;
+
+		s_Frames.buffers[lease].leases.fetch_sub(1, std::memory_order_release);
+	}
+
+	std::pmr::memory_resource* FrameAllocator::GetResource()
+	{
+		return &s_Resource;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,93 @@
+#pragma once
+
+#include "Engine/Core/Core.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace Engine
+{
+	/* Per-frame linear allocator.
+	*	Transient memory (temporary arrays, render command payloads, copies of event payloads) is bumped
+	*	out of an arena and never freed individually; the whole arena is reset at once. Allocating is a
+	*	pointer increment and freeing costs nothing.
+	*
+	*	There are BufferCount sets of arenas, used round-robin. BeginFrame, called by the Application at
+	*	the top of every frame, moves to the next set and resets it, so memory allocated in a frame stays
+	*	valid until the end of the next BufferCount - 1 frames (the next frame, by default). Each set has
+	*	one arena per job system thread (see Jobs::GetThreadIndex), so the main thread and the workers
+	*	allocate without contention. Other threads share one locked arena. Arenas start small, grow by
+	*	adding blocks, and are merged into one block of the combined size when reset, so after a few
+	*	frames every frame is served from a single block.
+	*
+	*	Memory that must outlive that window, such as a frame packet that the render thread draws later,
+	*	holds a lease on its frame's set (Retain). A leased set is not reset when its turn comes; it
+	*	keeps growing until every lease is released, so the main thread never waits.
+	*
+	*	Destructors are never run: only trivially destructible objects, or objects whose destructors
+	*	don't matter, should be created here. Init, Shutdown, BeginFrame and Retain are main thread only.
+	*/
+	class ENGINE_API FrameAllocator
+	{
+	public:
+		static constexpr uint32_t NoLease = UINT32_MAX;
+
+		// Arenas are allocated on first use, so idle workers cost nothing.
+		static void Init(uint32_t bufferCount = 2, size_t arenaSize = 256 * 1024);
+		static void Shutdown();
+
+		static bool IsInitialized();
+
+		static void BeginFrame();
+
+		// Memory from the current frame. Falls back to the global heap, and leaks, if the allocator isn't initialized.
+		static void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+		template<typename T, typename... T_Args>
+		static T* New(T_Args&&... args)
+		{
+			return new (Allocate(sizeof(T), alignof(T))) T(std::forward<T_Args>(args)...);
+		}
+
+		// Default-initialized, so trivial types are left uninitialized.
+		template<typename T>
+		static std::span<T> NewArray(size_t count)
+		{
+			T* data = static_cast<T*>(Allocate(sizeof(T) * count, alignof(T)));
+			std::uninitialized_default_construct_n(data, count);
+
+			return { data, count };
+		}
+
+		template<typename T>
+		static std::span<T> Copy(std::span<const T> source)
+		{
+			static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable arrays can be copied into frame memory.");
+
+			T* data = static_cast<T*>(Allocate(sizeof(T) * source.size(), alignof(T)));
+			std::memcpy(data, source.data(), sizeof(T) * source.size());
+
+			return { data, source.size() };
+		}
+
+		// Null-terminated.
+		static std::string_view Copy(std::string_view source);
+
+		// Keeps the current frame's memory from being reset until the lease is released. Release may be
+		//	called from any thread, and ignores NoLease.
+		static uint32_t Retain();
+		static void Release(uint32_t lease);
+
+		// A std::pmr resource over the current frame's memory, for containers that live within the frame.
+		//	Deallocation does nothing.
+		static std::pmr::memory_resource* GetResource();
+	};
+}
\ No newline at end of file
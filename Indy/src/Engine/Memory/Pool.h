@@ -0,0 +1,362 @@
+#pragma once
+
+#include "Engine/Jobs/Jobs.h"
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Engine
+{
+	// Generational handle to an object in a Pool. A slot's generation changes whenever its object is
+	//	destroyed, so handles to a destroyed (and possibly reused) slot are detected as stale.
+	template<typename T>
+	struct PoolHandle
+	{
+		static constexpr uint32_t InvalidIndex = UINT32_MAX;
+
+		uint32_t index = InvalidIndex;
+		uint32_t generation = 0;
+
+		bool IsValid() const { return index != InvalidIndex; };
+
+		bool operator==(const PoolHandle&) const = default;
+	};
+
+	/* Typed object pool with O(1) creation and destruction.
+	*	Objects live in slots, which are carved out of blocks allocated on cache line boundaries. The
+	*	first block holds FirstBlockSize slots and every further block doubles the capacity, so a pool
+	*	needs few blocks, and a handle's index maps to its block with a bit scan. Blocks are never moved
+	*	or freed before the pool is destroyed, so objects have stable addresses, and destroyed slots are
+	*	recycled through an intrusive free list, most recently freed first.
+	*
+	*	Objects can be addressed by handle (Create, Destroy, Get), which detects stale references, or by
+	*	pointer (New, Delete), as a drop-in replacement for std::make_unique and delete.
+	*
+	*	A pool is single-threaded unless T_ThreadCaches is set. Then every job system thread (see
+	*	Jobs::GetThreadIndex) keeps a small cache of free slots, refilled from and flushed to the shared
+	*	free list in batches under a lock, so most creations and destructions don't contend. Other
+	*	threads always take the lock. Get is lock-free, but doesn't keep an object from being destroyed
+	*	concurrently: it only detects handles whose object was destroyed before the call.
+	*/
+	template<typename T, bool T_ThreadCaches = false>
+	class Pool
+	{
+		static constexpr size_t CacheLineSize = 64;
+
+		struct Slot
+		{
+			alignas(T) std::byte storage[sizeof(T)];
+
+			// Odd while the slot holds an object.
+			std::atomic<uint32_t> generation;
+
+			uint32_t index;
+			uint32_t next_free;
+		};
+
+		static_assert(offsetof(Slot, storage) == 0, "Pool objects must be at the start of their slot.");
+
+		static constexpr size_t BlockAlignment = alignof(Slot) > CacheLineSize ? alignof(Slot) : CacheLineSize;
+
+		static constexpr uint32_t ThreadCacheSize = 32;
+
+		struct alignas(CacheLineSize) ThreadCache
+		{
+			uint32_t count = 0;
+			uint32_t indices[ThreadCacheSize];
+
+			// Objects created minus objects destroyed by this thread, so the size isn't a contended counter.
+			int32_t size = 0;
+		};
+
+		// Read by Get without the lock when thread caches are enabled.
+		using Capacity = std::conditional_t<T_ThreadCaches, std::atomic<uint32_t>, uint32_t>;
+
+	public:
+		using Handle = PoolHandle<T>;
+
+		static constexpr uint32_t FirstBlockSize = 64;
+		static constexpr uint32_t MaxBlocks = 25;
+
+		Pool()
+		{
+			if constexpr (T_ThreadCaches)
+			{
+				// Threads that join the job system later, e.g. after a restart with more workers, take the lock.
+				m_CacheCount = Jobs::IsRunning() ? Jobs::GetWorkerCount() + 1 : 0;
+				m_Caches = std::make_unique<ThreadCache[]>(m_CacheCount);
+			}
+		}
+
+		~Pool()
+		{
+			for (uint32_t block = 0; block < MaxBlocks; block++)
+			{
+				Slot* slots = m_Blocks[block].load(std::memory_order_relaxed);
+				if (slots == nullptr)
+					break;
+
+				if constexpr (!std::is_trivially_destructible_v<T>)
+				{
+					for (uint32_t i = 0; i < GetBlockSize(block); i++)
+					{
+						if (slots[i].generation.load(std::memory_order_relaxed) & 1)
+							GetObject(slots[i])->~T();
+					}
+				}
+
+				::operator delete(slots, std::align_val_t(BlockAlignment));
+			}
+		}
+
+		Pool(const Pool&) = delete;
+		Pool& operator=(const Pool&) = delete;
+
+		template<typename... T_Args>
+		Handle Create(T_Args&&... args)
+		{
+			Slot& slot = AcquireSlot();
+			::new (static_cast<void*>(slot.storage)) T(std::forward<T_Args>(args)...);
+
+			uint32_t generation = slot.generation.load(std::memory_order_relaxed) + 1;
+			slot.generation.store(generation, std::memory_order_release);
+
+			return Handle{ slot.index, generation };
+		}
+
+		// Returns false if the handle is stale.
+		bool Destroy(Handle handle)
+		{
+			Slot* slot = GetSlot(handle);
+			if (slot == nullptr)
+				return false;
+
+			ReleaseSlot(*slot);
+			return true;
+		}
+
+		// Returns nullptr if the handle is stale.
+		T* Get(Handle handle) const
+		{
+			Slot* slot = GetSlot(handle);
+			return slot != nullptr ? GetObject(*slot) : nullptr;
+		}
+
+		template<typename... T_Args>
+		T* New(T_Args&&... args)
+		{
+			return Get(Create(std::forward<T_Args>(args)...));
+		}
+
+		// The object must have come from this pool. Null is ignored.
+		void Delete(T* object)
+		{
+			if (object != nullptr)
+				ReleaseSlot(*reinterpret_cast<Slot*>(object));
+		}
+
+		Handle GetHandle(const T* object) const
+		{
+			const Slot& slot = *reinterpret_cast<const Slot*>(object);
+			return Handle{ slot.index, slot.generation.load(std::memory_order_relaxed) };
+		}
+
+		// Number of live objects. Only exact while no other thread is creating or destroying objects.
+		uint32_t GetSize() const
+		{
+			int32_t size = m_Size;
+			for (uint32_t i = 0; i < m_CacheCount; i++)
+				size += m_Caches[i].size;
+
+			return (uint32_t)size;
+		}
+
+		// Number of slots handed out so far, live or free.
+		uint32_t GetCapacity() const { return m_Capacity; };
+
+		// Invokes function(object) for every live object, in slot order. Not thread-safe.
+		template<typename T_Function>
+		void ForEach(T_Function&& function)
+		{
+			for (uint32_t index = 0; index < m_Capacity; index++)
+			{
+				Slot& slot = GetSlot(index);
+
+				if (slot.generation.load(std::memory_order_relaxed) & 1)
+					function(*GetObject(slot));
+			}
+		}
+
+	private:
+		static uint32_t GetBlockSize(uint32_t block) { return FirstBlockSize << block; };
+
+		static T* GetObject(Slot& slot) { return std::launder(reinterpret_cast<T*>(slot.storage)); };
+
+		// Block b holds indices [FirstBlockSize * (2^b - 1), FirstBlockSize * (2^(b+1) - 1)).
+		Slot& GetSlot(uint32_t index) const
+		{
+			uint64_t position = (uint64_t)index + FirstBlockSize;
+			uint32_t block = (uint32_t)std::bit_width(position) - 1 - (uint32_t)std::countr_zero(FirstBlockSize);
+
+			Slot* slots = m_Blocks[block].load(std::memory_order_acquire);
+			return slots[position - ((uint64_t)FirstBlockSize << block)];
+		}
+
+		Slot* GetSlot(Handle handle) const
+		{
+			if (handle.index >= m_Capacity)
+				return nullptr;
+
+			Slot& slot = GetSlot(handle.index);
+			if (slot.generation.load(std::memory_order_acquire) != handle.generation || !(handle.generation & 1))
+				return nullptr;
+
+			return &slot;
+		}
+
+		Slot& AcquireSlot()
+		{
+			uint32_t index;
+
+			if constexpr (T_ThreadCaches)
+			{
+				uint32_t thread = Jobs::GetThreadIndex();
+
+				if (thread < m_CacheCount)
+				{
+					ThreadCache& cache = m_Caches[thread];
+
+					if (cache.count == 0)
+					{
+						std::lock_guard<std::mutex> lock(m_Mutex);
+
+						while (cache.count < ThreadCacheSize / 2)
+							cache.indices[cache.count++] = AcquireIndex();
+					}
+
+					index = cache.indices[--cache.count];
+					cache.size++;
+				}
+				else
+				{
+					std::lock_guard<std::mutex> lock(m_Mutex);
+					index = AcquireIndex();
+					m_Size++;
+				}
+			}
+			else
+			{
+				index = AcquireIndex();
+				m_Size++;
+			}
+
+			return GetSlot(index);
+		}
+
+		void ReleaseSlot(Slot& slot)
+		{
+			GetObject(slot)->~T();
+			slot.generation.store(slot.generation.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+
+			if constexpr (T_ThreadCaches)
+			{
+				uint32_t thread = Jobs::GetThreadIndex();
+
+				if (thread < m_CacheCount)
+				{
+					ThreadCache& cache = m_Caches[thread];
+
+					if (cache.count == ThreadCacheSize)
+					{
+						std::lock_guard<std::mutex> lock(m_Mutex);
+
+						while (cache.count > ThreadCacheSize / 2)
+							ReleaseIndex(cache.indices[--cache.count]);
+					}
+
+					cache.indices[cache.count++] = slot.index;
+					cache.size--;
+				}
+				else
+				{
+					std::lock_guard<std::mutex> lock(m_Mutex);
+					ReleaseIndex(slot.index);
+					m_Size--;
+				}
+			}
+			else
+			{
+				ReleaseIndex(slot.index);
+				m_Size--;
+			}
+		}
+
+		// Takes a slot from the free list, or a new one. Under the lock with thread caches.
+		uint32_t AcquireIndex()
+		{
+			if (m_FreeList != Handle::InvalidIndex)
+			{
+				uint32_t index = m_FreeList;
+				m_FreeList = GetSlot(index).next_free;
+
+				return index;
+			}
+
+			uint32_t index = m_Capacity;
+			uint64_t position = (uint64_t)index + FirstBlockSize;
+
+			// The first slot of a block: positions of block b start at FirstBlockSize << b.
+			if (std::has_single_bit(position))
+				AddBlock((uint32_t)std::countr_zero(position) - (uint32_t)std::countr_zero(FirstBlockSize));
+
+			m_Capacity = index + 1;
+			return index;
+		}
+
+		void ReleaseIndex(uint32_t index)
+		{
+			GetSlot(index).next_free = m_FreeList;
+			m_FreeList = index;
+		}
+
+		void AddBlock(uint32_t block)
+		{
+			if (block >= MaxBlocks)
+				throw std::bad_alloc();
+
+			uint32_t size = GetBlockSize(block);
+			uint32_t first = FirstBlockSize * ((1u << block) - 1);
+
+			Slot* slots = static_cast<Slot*>(::operator new(sizeof(Slot) * size, std::align_val_t(BlockAlignment)));
+
+			for (uint32_t i = 0; i < size; i++)
+			{
+				Slot* slot = ::new (static_cast<void*>(&slots[i])) Slot;
+				slot->generation.store(0, std::memory_order_relaxed);
+				slot->index = first + i;
+				slot->next_free = Handle::InvalidIndex;
+			}
+
+			m_Blocks[block].store(slots, std::memory_order_release);
+		}
+
+	private:
+		std::atomic<Slot*> m_Blocks[MaxBlocks] = {};
+
+		// Guarded by m_Mutex when thread caches are enabled.
+		uint32_t m_FreeList = Handle::InvalidIndex;
+		Capacity m_Capacity = 0;
+		int32_t m_Size = 0;
+
+		std::mutex m_Mutex;
+		std::unique_ptr<ThreadCache[]> m_Caches;
+		uint32_t m_CacheCount = 0;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,141 @@
+#include "GLFWCallbacks.h"
+
+#include "Engine/Core/Log.h"
+#include "Engine/EventSystem/EventReplayer.h"
+
+namespace Engine
+{
+	// GLFW callbacks go through the frame event stream when it's enabled, and are dispatched immediately otherwise.
+	template<typename T_Event_Type>
+	static void DispatchWindowEvent(const T_Event_Type& event)
+	{
+		if (Events::IsStreamEnabled())
+			Events::Stream<T_Event_Type>(event);
+		else
+			Events::Dispatch<T_Event_Type>(event);
+	}
+
+	static GLFWwindow* s_ReplayWindow = nullptr;
+
+	template<typename T_Event_Type>
+	static void RemapReplayedWindow(void* event)
+	{
+		if (s_ReplayWindow != nullptr)
+			static_cast<T_Event_Type*>(event)->window = s_ReplayWindow;
+	}
+
+	void GLFWErrorCallback(int error, const char* description)
+	{
+		INDY_CORE_ERROR("GLFW Error ({0}): {1}", error, description);
+	}
+
+	void SetGLFWEventCallbacks(GLFWwindow* window)
+	{
+		// GLFW Window Event Callbacks
+		glfwSetWindowCloseCallback(window, [](GLFWwindow* window)
+		{
+			DispatchWindowEvent(WindowCloseEvent{ window, true });
+		});
+
+		glfwSetWindowSizeCallback(window, [](GLFWwindow* window, int width, int height)
+		{
+			DispatchWindowEvent(WindowResizeEvent{ window, width, height });
+		});
+
+		glfwSetScrollCallback(window, [](GLFWwindow* window, double xoffset, double yoffset) 
+		{
+			DispatchWindowEvent(ScrollEvent{ window, xoffset, yoffset });
+		});
+
+		glfwSetWindowFocusCallback(window, [](GLFWwindow* window, int focused)
+		{
+			switch (focused)
+			{
+				case GLFW_TRUE:
+				{
+					DispatchWindowEvent(WindowFocusEvent{ window });
+					break;
+				}
+				default:
+				{
+					DispatchWindowEvent(WindowLoseFocusEvent{ window });
+					break;
+				}
+			}
+		});
+
+		glfwSetWindowPosCallback(window, [](GLFWwindow* window, int xpos, int ypos) 
+		{
+			DispatchWindowEvent(WindowMoveEvent{ window, xpos, ypos });
+		});
+
+		// GLFW Mouse Input Event Callbacks
+		glfwSetCursorPosCallback(window, [](GLFWwindow* window, double xpos, double ypos)
+		{
+			DispatchWindowEvent(MouseMoveEvent{ window, xpos, ypos });
+		});
+
+		glfwSetMouseButtonCallback(window, [](GLFWwindow* window, int button, int action, int mods) 
+		{
+			DispatchWindowEvent(MouseButtonEvent{ window, button, action, mods });
+		});
+
+		// GLFW Keyboard Input Events
+		glfwSetKeyCallback(window, [](GLFWwindow* window, int key, int scancode, int action, int mods)
+		{
+			DispatchWindowEvent(KeyboardEvent{ window, key, scancode, action, mods });
+		});
+
+		// GLFW File Drop Events
+		glfwSetDropCallback(window, [](GLFWwindow* window, int count, const char** paths)
+		{
+			// Listeners get a view of GLFW's path list; nothing is copied or allocated.
+			Events::Dispatch(FileDropEvent{ window, { paths, (size_t)count } });
+		});
+	}
+
+	void SetGLFWReplayWindow(GLFWwindow* window)
+	{
+		s_ReplayWindow = window;
+
+		// Every recordable GLFW event. File drops borrow their paths, so they're never recorded.
+		EventReplayer::SetRemap<WindowCloseEvent>(&RemapReplayedWindow<WindowCloseEvent>);
+		EventReplayer::SetRemap<WindowResizeEvent>(&RemapReplayedWindow<WindowResizeEvent>);
+		EventReplayer::SetRemap<WindowFocusEvent>(&RemapReplayedWindow<WindowFocusEvent>);
+		EventReplayer::SetRemap<WindowLoseFocusEvent>(&RemapReplayedWindow<WindowLoseFocusEvent>);
+		EventReplayer::SetRemap<WindowMoveEvent>(&RemapReplayedWindow<WindowMoveEvent>);
+		EventReplayer::SetRemap<ScrollEvent>(&RemapReplayedWindow<ScrollEvent>);
+		EventReplayer::SetRemap<MouseMoveEvent>(&RemapReplayedWindow<MouseMoveEvent>);
+		EventReplayer::SetRemap<MouseButtonEvent>(&RemapReplayedWindow<MouseButtonEvent>);
+		EventReplayer::SetRemap<KeyboardEvent>(&RemapReplayedWindow<KeyboardEvent>);
+	}
+
+	void BindGLFWInputTracing(GLFWwindow* window, std::vector<EventHandle>& handles)
+	{
+		/*	Note:
+				Input related events will later be passed on some sort of input handler class. The window class should not be responsible for input.
+		*/
+
+		EventChannel channel = MakeEventChannel(window);
+
+		// General Input Callbacks
+		handles.emplace_back(Events::BindChannel<ScrollEvent>(channel, [](const ScrollEvent& event) { INDY_CORE_TRACE("[Scroll Event]: xOffset: {0}, yOffset: {1}", event.xoffset, event.yoffset); }));
+
+		// Keyboard Input Callbacks
+		handles.emplace_back(Events::BindChannel<KeyboardEvent>(channel, [](const KeyboardEvent& event) { INDY_CORE_TRACE("[Key Event]: key: {0}, scancode: {1}, action: {2}, mods: {3}", event.key, event.scancode, event.action, event.mods); }));
+
+		// Mouse Input Callbacks
+		handles.emplace_back(Events::BindChannel<MouseMoveEvent>(channel, [](const MouseMoveEvent& event) { INDY_CORE_TRACE("[Mouse Move Event]: x: {0}, y: {1}", event.xpos, event.ypos); }));
+		handles.emplace_back(Events::BindChannel<MouseButtonEvent>(channel, [](const MouseButtonEvent& event) 
+		{ 
+			INDY_CORE_TRACE("[Mouse Button Event]: Button: {0}, Action: {1}, Mods: {2}", event.button, event.action, event.mods); 
+		}));
+
+		// File Callbacks
+		handles.emplace_back(Events::BindChannel<FileDropEvent>(channel, [](const FileDropEvent& event)
+		{
+			for (const char* path : event.paths)
+				INDY_CORE_TRACE("[File Drop Event]: {0}", path);
+		}));
+	}
+}
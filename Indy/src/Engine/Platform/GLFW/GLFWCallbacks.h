@@ -0,0 +1,23 @@
+#pragma once
+
+#include "GLFWEvents.h"
+
+#include <vector>
+
+namespace Engine
+{
+	// Logs GLFW errors. Set before glfwInit so initialization errors are reported too.
+	void GLFWErrorCallback(int error, const char* description);
+
+	// Installs the GLFW callbacks that turn a window's input and window changes into events
+	//	(see GLFWEvents.h), dispatched on the window's channel.
+	void SetGLFWEventCallbacks(GLFWwindow* window);
+
+	// Points replayed GLFW events at a window of this run (see EventReplayer::SetRemap). Recorded events
+	//	hold the recording session's window handle, which would never match a current window's channel.
+	//	Pass nullptr once the window is destroyed.
+	void SetGLFWReplayWindow(GLFWwindow* window);
+
+	// Binds listeners that trace a window's input events, appending their handles.
+	void BindGLFWInputTracing(GLFWwindow* window, std::vector<EventHandle>& handles);
+}
@@ -0,0 +1,110 @@
+#pragma once
+
+#include "Engine/EventSystem/Events.h"
+
+#include <GLFW/glfw3.h>
+
+#include <span>
+
+// Events raised by GLFW windows. Every platform's window is backed by GLFW, so they're shared (see GLFWCallbacks.h).
+
+namespace Engine
+{
+	// Window Events
+
+	struct WindowCloseEvent
+	{
+		GLFWwindow* window;
+		bool b_AppShouldTerminate;
+		EventChannel getChannel() const { return MakeEventChannel(window); };
+	};
+
+	struct WindowResizeEvent
+	{
+		GLFWwindow* window;
+		int width, height;
+		EventChannel getChannel() const { return MakeEventChannel(window); };
+
+		static constexpr EventCoalescePolicy CoalescePolicy = EventCoalescePolicy::KeepLast;
+		bool coalescesWith(const WindowResizeEvent& next) const { return window == next.window; };
+	};
+	
+	struct WindowFocusEvent
+	{
+		GLFWwindow* window;
+		EventChannel getChannel() const { return MakeEventChannel(window); };
+	};
+
+	struct WindowLoseFocusEvent
+	{
+		GLFWwindow* window;
+		EventChannel getChannel() const { return MakeEventChannel(window); };
+	};
+
+	struct WindowMoveEvent
+	{
+		GLFWwindow* window;
+		int xpos, ypos;
+		EventChannel getChannel() const { return MakeEventChannel(window); };
+
+		static constexpr EventCoalescePolicy CoalescePolicy = EventCoalescePolicy::KeepLast;
+		bool coalescesWith(const WindowMoveEvent& next) const { return window == next.window; };
+	};
+
+	// General Input Events
+	struct ScrollEvent
+	{
+		GLFWwindow* window;
+		double xoffset, yoffset;
+		EventChannel getChannel() const { return MakeEventChannel(window); };
+
+		static constexpr EventCoalescePolicy CoalescePolicy = EventCoalescePolicy::Accumulate;
+		bool coalescesWith(const ScrollEvent& next) const { return window == next.window; };
+
+		void accumulate(const ScrollEvent& next)
+		{
+			xoffset += next.xoffset;
+			yoffset += next.yoffset;
+		}
+	};
+
+	// Mouse Events
+
+	struct MouseMoveEvent
+	{
+		GLFWwindow* window;
+		double xpos, ypos;
+		EventChannel getChannel() const { return MakeEventChannel(window); };
+
+		static constexpr EventCoalescePolicy CoalescePolicy = EventCoalescePolicy::KeepLast;
+		bool coalescesWith(const MouseMoveEvent& next) const { return window == next.window; };
+	};
+
+	struct MouseButtonEvent
+	{
+		GLFWwindow* window;
+		int button, action, mods;
+		EventChannel getChannel() const { return MakeEventChannel(window); };
+	};
+
+	// Keyboard Events
+	struct KeyboardEvent
+	{
+		GLFWwindow* window;
+		int key, scancode, action, mods;
+		EventChannel getChannel() const { return MakeEventChannel(window); };
+	};
+
+	// File Events
+
+	// Paths of files dropped onto the window. They point into GLFW's own buffers, which are only
+	//	valid until the callback returns, so this event can only be dispatched immediately.
+	struct FileDropEvent
+	{
+		GLFWwindow* window;
+		std::span<const char* const> paths;
+		EventChannel getChannel() const { return MakeEventChannel(window); };
+
+		static constexpr bool BorrowsPayload = true;
+	};
+}
\ No newline at end of file
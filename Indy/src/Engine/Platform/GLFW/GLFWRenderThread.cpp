@@ -0,0 +1,35 @@
+#include "GLFWRenderThread.h"
+
+namespace Engine
+{
+	void GLFWRenderThread::Start(GLFWwindow* window, bool b_threaded)
+	{
+		m_GLFW_Window = window;
+
+		// A context can only be current on one thread; the render thread takes it in onAttach.
+		glfwMakeContextCurrent(nullptr);
+
+		RenderThread::Start(b_threaded);
+	}
+
+	void GLFWRenderThread::onAttach()
+	{
+		glfwMakeContextCurrent(m_GLFW_Window);
+	}
+
+	void GLFWRenderThread::onRender(const FramePacket& packet)
+	{
+		glClearColor(packet.clear_color[0], packet.clear_color[1], packet.clear_color[2], packet.clear_color[3]);
+		glClear(GL_COLOR_BUFFER_BIT);
+
+		for (const RenderCommand& command : packet.commands)
+			command.function(command.context);
+
+		glfwSwapBuffers(m_GLFW_Window);
+	}
+
+	void GLFWRenderThread::onDetach()
+	{
+		glfwMakeContextCurrent(nullptr);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "Engine/Renderer/RenderThread.h"
+
+#include <GLFW/glfw3.h>
+
+namespace Engine
+{
+	// Draws frame packets into a GLFW window's OpenGL context, which the render thread makes current
+	//	on itself. The window must not be destroyed until the thread is stopped.
+	class GLFWRenderThread : public RenderThread
+	{
+	public:
+		GLFWRenderThread() = default;
+		~GLFWRenderThread() { Stop(); };
+
+		void Start(GLFWwindow* window, bool b_threaded);
+
+	protected:
+		void onAttach() override;
+		void onRender(const FramePacket& packet) override;
+		void onDetach() override;
+
+	private:
+		GLFWwindow* m_GLFW_Window = nullptr;
+	};
+}
\ No newline at end of file
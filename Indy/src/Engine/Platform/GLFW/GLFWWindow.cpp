@@ -0,0 +1,147 @@
+#include "GLFWWindow.h"
+
+#include "Engine/Core/FramePacer.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Platform/GLFW/GLFWCallbacks.h"
+
+namespace Engine
+{
+	GLFWWindow::GLFWWindow(const WindowSpec& spec)
+		: m_WindowSpec(spec)
+	{
+		// GLFW Error Callback, set first so a missing display is reported
+		glfwSetErrorCallback(GLFWErrorCallback);
+
+		// Initialize GLFW. On Linux, it picks Wayland or X11 at runtime, whichever it was built with and can connect to.
+		int b_success = glfwInit();
+
+		if (!b_success)
+		{
+			INDY_CORE_CRITICAL("Could not initialize GLFW! Headless mode (--headless) runs without a display.");
+			return;
+		}
+
+		#ifdef ENGINE_PLATFORM_LINUX
+			INDY_CORE_INFO("Using the {0} display server.", glfwGetPlatform() == GLFW_PLATFORM_WAYLAND ? "Wayland" : "X11");
+		#endif
+
+		// Create GLFW Window
+		m_GLFW_Window = glfwCreateWindow((int)spec.width, (int)spec.height, spec.title.c_str(), NULL, NULL);
+
+		if (!m_GLFW_Window)
+		{
+			INDY_CORE_CRITICAL("Window creation failed");
+			return;
+		}
+
+		b_Focused = glfwGetWindowAttrib(m_GLFW_Window, GLFW_FOCUSED) == GLFW_TRUE;
+
+		// Listeners are scoped to this window's channel, so they need the window handle.
+		this->BindApplicationEvents();
+
+		SetGLFWEventCallbacks(m_GLFW_Window);
+		SetGLFWReplayWindow(m_GLFW_Window);
+
+		m_RenderThread.Start(m_GLFW_Window, spec.b_RenderThread);
+	}
+
+	GLFWWindow::~GLFWWindow()
+	{
+		for (EventHandle& handle : m_eventHandles)
+		{
+			Events::UnBind(handle);
+		}
+
+		m_RenderThread.Stop();
+
+		if (m_GLFW_Window)
+		{
+			SetGLFWReplayWindow(nullptr);
+			glfwDestroyWindow(m_GLFW_Window);
+		}
+
+		glfwTerminate();
+	}
+
+	void GLFWWindow::BindApplicationEvents()
+	{
+		// This window's events only. Other windows have their own channels.
+		EventChannel channel = MakeEventChannel(m_GLFW_Window);
+
+		// Window Related Callbacks
+		m_eventHandles.emplace_back(Events::BindChannel<WindowCloseEvent>(channel, this, &GLFWWindow::onWindowClose));
+		m_eventHandles.emplace_back(Events::BindChannel<WindowResizeEvent>(channel, this, &GLFWWindow::onWindowResize));
+		m_eventHandles.emplace_back(Events::BindChannel<WindowMoveEvent>(channel, this, &GLFWWindow::onWindowMove));
+		m_eventHandles.emplace_back(Events::BindChannel<WindowFocusEvent>(channel, this, &GLFWWindow::onWindowFocus));
+		m_eventHandles.emplace_back(Events::BindChannel<WindowLoseFocusEvent>(channel, this, &GLFWWindow::onWindowLoseFocus));
+
+		BindGLFWInputTracing(m_GLFW_Window, m_eventHandles);
+	}
+
+	void GLFWWindow::onUpdate()
+	{
+		if (!m_GLFW_Window)
+			return;
+
+		// A background window has nothing to do until it gets input, so it blocks instead of spinning.
+		if (b_Focused)
+			glfwPollEvents();
+		else
+			glfwWaitEventsTimeout(FramePacer::GetUnfocusedTimeout());
+
+		if (Events::IsStreamEnabled())
+			Events::FlushStream();
+	}
+
+	double GLFWWindow::GetRefreshRate() const
+	{
+		if (!m_GLFW_Window)
+			return 0.0;
+
+		// Windowed mode windows have no monitor of their own; they're assumed to be on the primary one.
+		GLFWmonitor* monitor = glfwGetWindowMonitor(m_GLFW_Window);
+		if (!monitor)
+			monitor = glfwGetPrimaryMonitor();
+
+		const GLFWvidmode* mode = monitor ? glfwGetVideoMode(monitor) : nullptr;
+		return mode ? (double)mode->refreshRate : 0.0;
+	}
+
+	//  -------------
+	//  Event Handles
+	//  -------------
+
+	void GLFWWindow::onWindowClose(const WindowCloseEvent& event) 
+	{
+		INDY_CORE_WARN("[Window Close Event]: Closing...");
+
+		m_RenderThread.Stop();
+
+		SetGLFWReplayWindow(nullptr);
+		glfwDestroyWindow(event.window);
+		m_GLFW_Window = nullptr;
+	};
+
+	void GLFWWindow::onWindowResize(const WindowResizeEvent& event)
+	{
+		INDY_CORE_TRACE("[Window Resize Event]: newWidth: {0}, newHeight: {1}", event.width, event.height);
+		//glfwSetWindowSize(event.window, event.width, event.height);
+	};
+
+	void GLFWWindow::onWindowMove(const WindowMoveEvent& event)
+	{
+		INDY_CORE_TRACE("[Window Move Event]: newX: {0}, newY: {1}", event.xpos, event.ypos);
+	};
+
+	void GLFWWindow::onWindowFocus(const WindowFocusEvent& event)
+	{
+		INDY_CORE_WARN("[Window Focus Event]");
+		b_Focused = true;
+	};
+
+	void GLFWWindow::onWindowLoseFocus(const WindowLoseFocusEvent& event)
+	{
+		INDY_CORE_WARN("[Window Lose Focus Event]");
+		b_Focused = false;
+	};
+}
\ No newline at end of file
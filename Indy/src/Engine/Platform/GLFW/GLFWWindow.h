@@ -0,0 +1,54 @@
+#pragma once
+
+#include "Engine/Core/Window.h"
+#include "Engine/EventSystem/Events.h"
+#include "Engine/Platform/GLFW/GLFWEvents.h"
+#include "Engine/Platform/GLFW/GLFWRenderThread.h"
+
+#include <GLFW/glfw3.h>
+
+namespace Engine
+{
+	// The desktop window on every supported platform. GLFW covers the platform differences (Win32,
+	//	X11 and Wayland), so Windows and Linux share this class.
+	class GLFWWindow : public Window
+	{
+		private:
+			// Event Handles
+			void onWindowClose(const WindowCloseEvent& event);
+			void onWindowResize(const WindowResizeEvent& event);
+			void onWindowMove(const WindowMoveEvent& event);
+			void onWindowFocus(const WindowFocusEvent& event);
+			void onWindowLoseFocus(const WindowLoseFocusEvent& event);
+
+		public:
+			GLFWWindow(const WindowSpec& spec);
+			virtual ~GLFWWindow();
+
+			void onUpdate() override;
+
+			bool IsOpen() const override { return m_GLFW_Window != nullptr; };
+
+			FramePacket& BeginFramePacket() override { return m_RenderThread.BeginPacket(); };
+			void SubmitFramePacket() override { m_RenderThread.SubmitPacket(); };
+
+			unsigned int GetWidth() const override { return m_WindowSpec.width; };
+			unsigned int GetHeight() const override { return m_WindowSpec.height; };
+
+			double GetRefreshRate() const override;
+
+		private:
+			void BindApplicationEvents();
+			std::vector<EventHandle> m_eventHandles;
+
+			GLFWwindow* m_GLFW_Window = nullptr;
+
+			// Unfocused windows wait for events instead of polling. See FramePacer.
+			bool b_Focused = true;
+
+			WindowSpec m_WindowSpec;
+
+			// Owns the context and the swap. Stopped before the window is destroyed.
+			GLFWRenderThread m_RenderThread;
+	};
+}
\ No newline at end of file
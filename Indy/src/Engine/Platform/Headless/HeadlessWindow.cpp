@@ -0,0 +1,54 @@
+#include "HeadlessWindow.h"
+
+#include "Engine/Core/Log.h"
+#include "Engine/Platform/GLFW/GLFWCallbacks.h"
+
+namespace Engine
+{
+	HeadlessWindow::HeadlessWindow(const WindowSpec& spec)
+		: m_WindowSpec(spec)
+	{
+		glfwSetErrorCallback(GLFWErrorCallback);
+
+		glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+
+		if (!glfwInit())
+		{
+			INDY_CORE_CRITICAL("Could not initialize GLFW's null platform!");
+			return;
+		}
+
+		glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
+		m_GLFW_Window = glfwCreateWindow((int)spec.width, (int)spec.height, spec.title.c_str(), NULL, NULL);
+
+		if (!m_GLFW_Window)
+		{
+			INDY_CORE_CRITICAL("Headless window creation failed");
+			return;
+		}
+
+		SetGLFWEventCallbacks(m_GLFW_Window);
+		SetGLFWReplayWindow(m_GLFW_Window);
+
+		INDY_CORE_INFO("Running headless.");
+	}
+
+	HeadlessWindow::~HeadlessWindow()
+	{
+		if (m_GLFW_Window)
+		{
+			SetGLFWReplayWindow(nullptr);
+			glfwDestroyWindow(m_GLFW_Window);
+		}
+
+		glfwTerminate();
+	}
+
+	void HeadlessWindow::onUpdate()
+	{
+		glfwPollEvents();
+
+		if (Events::IsStreamEnabled())
+			Events::FlushStream();
+	}
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "Engine/Core/Window.h"
+#include "Engine/Platform/GLFW/GLFWEvents.h"
+
+#include <GLFW/glfw3.h>
+
+namespace Engine
+{
+	/* Window for machines without a display or GPU, such as build servers.
+	*	GLFW is initialized with its null platform, which needs neither, and the window is created
+	*	without a graphics context. Nothing is rendered and no input arrives, but GLFW's timer and
+	*	window handles work as usual, so the application loop, Time, the event system and jobs run
+	*	unchanged. Selected with WindowSpec::b_Headless. Frame packets are discarded.
+	*/
+	class HeadlessWindow : public Window
+	{
+		public:
+			HeadlessWindow(const WindowSpec& spec);
+			virtual ~HeadlessWindow();
+
+			void onUpdate() override;
+
+			bool IsOpen() const override { return m_GLFW_Window != nullptr; };
+
+			FramePacket& BeginFramePacket() override { m_FramePacket.commands.clear(); return m_FramePacket; };
+			void SubmitFramePacket() override {};
+
+			unsigned int GetWidth() const override { return m_WindowSpec.width; };
+			unsigned int GetHeight() const override { return m_WindowSpec.height; };
+
+			double GetRefreshRate() const override { return 0.0; };
+
+		private:
+			GLFWwindow* m_GLFW_Window = nullptr;
+
+			WindowSpec m_WindowSpec;
+
+			FramePacket m_FramePacket;
+	};
+}
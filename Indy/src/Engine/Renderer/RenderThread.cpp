@@ -0,0 +1,184 @@
+#include "RenderThread.h"
+
+#include "Engine/Core/Log.h"
+
+#include <chrono>
+
+namespace Engine
+{
+	void RenderThread::Start(bool b_threaded)
+	{
+		if (b_Running)
+			return;
+
+		b_Running = true;
+		b_Threaded = b_threaded;
+		b_Stopping = false;
+
+		if (b_Threaded)
+			m_Thread = std::thread(&RenderThread::RenderLoop, this);
+		else
+			onAttach();
+	}
+
+	void RenderThread::Stop()
+	{
+		// Packets that were dropped, or never drawn, don't keep their frame's memory from being reused.
+		//	Released even when already stopped, since packets may have been begun since.
+		auto releasePackets = [this]()
+		{
+			m_PendingSlot = NoSlot;
+			for (FramePacket& packet : m_Packets)
+			{
+				FrameAllocator::Release(packet.frame_memory);
+				packet.frame_memory = FrameAllocator::NoLease;
+			}
+		};
+
+		if (!b_Running)
+		{
+			releasePackets();
+			return;
+		}
+
+		if (b_Threaded)
+		{
+			{
+				std::lock_guard<std::mutex> lock(m_Mutex);
+				b_Stopping = true;
+			}
+
+			m_Submitted.notify_one();
+			m_Thread.join();
+		}
+		else
+			onDetach();
+
+		b_Running = false;
+		releasePackets();
+
+		if (m_PresentedCount != 0)
+		{
+			INDY_CORE_INFO("Render thread: {0} frames presented, {1} dropped, {2:.2f}ms average render time.",
+				m_PresentedCount, m_DroppedCount, m_RenderTime * 1000.0 / (double)m_PresentedCount);
+		}
+	}
+
+	FramePacket& RenderThread::BeginPacket()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+
+			// Any slot the render thread isn't drawing, preferring one that isn't waiting to be drawn.
+			//	While one slot is drawn and the other waits, the waiting frame is dropped.
+			uint32_t slot = m_RenderingSlot == 0 ? 1 : 0;
+			if (slot == m_PendingSlot && m_RenderingSlot == NoSlot)
+				slot = 1 - slot;
+
+			if (slot == m_PendingSlot)
+			{
+				m_PendingSlot = NoSlot;
+				m_DroppedCount++;
+			}
+
+			m_WritingSlot = slot;
+		}
+
+		FramePacket& packet = m_Packets[m_WritingSlot];
+		packet.commands.clear();
+
+		// A dropped packet still holds the lease from the frame it was filled in. Once stopped, packets
+		//	are never drawn, so they don't take a lease that nothing would release.
+		FrameAllocator::Release(packet.frame_memory);
+		packet.frame_memory = b_Running ? FrameAllocator::Retain() : FrameAllocator::NoLease;
+
+		return packet;
+	}
+
+	void RenderThread::SubmitPacket()
+	{
+		if (m_WritingSlot == NoSlot)
+			return;
+
+		uint32_t slot = m_WritingSlot;
+		m_WritingSlot = NoSlot;
+
+		if (!b_Running)
+			return;
+
+		if (!b_Threaded)
+		{
+			Render(slot);
+			return;
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+
+			// The render thread hasn't picked up the previous packet yet; only the latest frame is drawn.
+			if (m_PendingSlot != NoSlot)
+				m_DroppedCount++;
+
+			m_PendingSlot = slot;
+		}
+
+		m_Submitted.notify_one();
+	}
+
+	uint64_t RenderThread::GetPresentedCount() const
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		return m_PresentedCount;
+	}
+
+	uint64_t RenderThread::GetDroppedCount() const
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		return m_DroppedCount;
+	}
+
+	void RenderThread::RenderLoop()
+	{
+		onAttach();
+
+		std::unique_lock<std::mutex> lock(m_Mutex);
+		for (;;)
+		{
+			m_Submitted.wait(lock, [this]() { return m_PendingSlot != NoSlot || b_Stopping; });
+
+			if (m_PendingSlot == NoSlot)
+				break;
+
+			uint32_t slot = m_PendingSlot;
+			m_PendingSlot = NoSlot;
+			m_RenderingSlot = slot;
+
+			lock.unlock();
+			Render(slot);
+			lock.lock();
+
+			m_RenderingSlot = NoSlot;
+		}
+
+		lock.unlock();
+
+		onDetach();
+	}
+
+	void RenderThread::Render(uint32_t slot)
+	{
+		auto start = std::chrono::steady_clock::now();
+
+		FramePacket& packet = m_Packets[slot];
+		onRender(packet);
+
+		FrameAllocator::Release(packet.frame_memory);
+		packet.frame_memory = FrameAllocator::NoLease;
+
+		double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		m_PresentedCount++;
+		m_RenderTime += elapsed;
+	}
+}
\ No newline at end of file
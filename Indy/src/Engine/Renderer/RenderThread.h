@@ -0,0 +1,123 @@
+#pragma once
+
+#include "Engine/Core/Core.h"
+#include "Engine/Memory/FrameAllocator.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Engine
+{
+	// Runs on the render thread, with the window's context current.
+	struct RenderCommand
+	{
+		using Render_Fn = void(*)(void* context);
+
+		Render_Fn function;
+		void* context;
+	};
+
+	// Everything the render thread needs to draw one simulated frame. Filled by the main thread.
+	struct FramePacket
+	{
+		uint64_t frame = 0;
+
+		// Time::GetTime() and Time::GetAlpha() when the frame was simulated.
+		double time = 0.0;
+		double alpha = 0.0;
+
+		float clear_color[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
+
+		std::vector<RenderCommand> commands;
+
+		// Lease on the memory of the frame the packet was filled in (see FrameAllocator), so command
+		//	contexts can live there. Released once the packet is drawn or dropped.
+		uint32_t frame_memory = FrameAllocator::NoLease;
+
+		void Submit(RenderCommand::Render_Fn function, void* context) { commands.push_back({ function, context }); };
+	};
+
+	/* Double-buffered frame packets, drawn and presented on a dedicated thread.
+	*	The main thread owns OS event polling and simulation; the render thread owns the graphics
+	*	context and the swap. Each frame, the main thread fills one packet (BeginPacket) and hands it
+	*	over (SubmitPacket) while the render thread draws the other one, so a swap that blocks on
+	*	vsync never delays input polling, and input is simulated as soon as it's polled.
+	*
+	*	The main thread never waits for the render thread. If the render thread is still drawing when
+	*	the next packet is begun, the packet that is waiting to be drawn is reused, and the frame it
+	*	held is dropped. The render thread always draws the latest simulated frame. To keep frames from
+	*	being simulated only to be dropped, the main loop is paced to the display (see FramePacer).
+	*
+	*	Platforms implement onAttach, onRender and onDetach. Without a thread, packets are drawn on
+	*	the main thread during SubmitPacket, as if the render thread didn't exist.
+	*
+	*	BeginPacket, SubmitPacket, Start and Stop are main thread only.
+	*/
+	class ENGINE_API RenderThread
+	{
+	public:
+		RenderThread() = default;
+
+		// Derived classes must Stop the thread in their destructor, while onRender can still be called.
+		virtual ~RenderThread() = default;
+
+		RenderThread(const RenderThread&) = delete;
+		RenderThread& operator=(const RenderThread&) = delete;
+
+		void Start(bool b_threaded = true);
+
+		// Draws the last submitted packet, if it's still waiting, then joins the render thread.
+		void Stop();
+
+		bool IsRunning() const { return b_Running; };
+		bool IsThreaded() const { return b_Threaded; };
+
+		// The returned packet is empty apart from its clear color, and stays valid until SubmitPacket.
+		//	It holds a lease on the current frame's memory.
+		FramePacket& BeginPacket();
+		void SubmitPacket();
+
+		uint64_t GetPresentedCount() const;
+		uint64_t GetDroppedCount() const;
+
+	protected:
+		// Called on the render thread before the first packet, e.g. to make a context current.
+		virtual void onAttach() {};
+
+		// Draws and presents a packet.
+		virtual void onRender(const FramePacket& packet) = 0;
+
+		// Called on the render thread after the last packet.
+		virtual void onDetach() {};
+
+	private:
+		void RenderLoop();
+		void Render(uint32_t slot);
+
+	private:
+		static constexpr uint32_t NoSlot = UINT32_MAX;
+
+		FramePacket m_Packets[2];
+
+		// Guards the slots below and the counters. The packets themselves are owned by one thread
+		//	at a time: the writing slot by the main thread, the rendering slot by the render thread.
+		mutable std::mutex m_Mutex;
+		std::condition_variable m_Submitted;
+
+		uint32_t m_WritingSlot = NoSlot;
+		uint32_t m_PendingSlot = NoSlot;
+		uint32_t m_RenderingSlot = NoSlot;
+
+		uint64_t m_PresentedCount = 0;
+		uint64_t m_DroppedCount = 0;
+		double m_RenderTime = 0.0;
+
+		std::thread m_Thread;
+		bool b_Running = false;
+		bool b_Threaded = false;
+		bool b_Stopping = false;
+	};
+}
\ No newline at end of file
@@ -34,6 +34,20 @@ project "Sandbox"
 
 		includedirs "%{IncludeDirs.GLFW}"
 
+	filter "system:linux"
+
+		defines
+		{
+			"ENGINE_PLATFORM_LINUX"
+		}
+
+		includedirs "%{IncludeDirs.GLFW}"
+
+		-- Finds libIndy.so next to the executable.
+		linkoptions { "-Wl,-rpath,'$$ORIGIN'" }
+
+		links { "pthread" }
+
 	filter "configurations:Debug"
 		defines { "ENGINE_DEBUG" }
         runtime "Debug"
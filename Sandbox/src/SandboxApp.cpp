@@ -13,10 +13,7 @@ namespace Engine
 	void Sandbox::Run()
 	{
 		INDY_CORE_TRACE("Sandbox Start!");
-		while (m_IsRunning)
-		{
-			m_Window->onUpdate();
-		}
+		Application::Run();
 		INDY_CORE_TRACE("Sandbox End!");
 	}
 }
\ No newline at end of file
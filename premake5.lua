@@ -20,4 +20,5 @@ workspace "Indy"
 	-- Projects
 	include "Indy"
 	include "Sandbox"
+	include "Benchmarks"
 	include "Indy/lib/GLFW"
\ No newline at end of file